@@ -0,0 +1,98 @@
+// main114.cc is a part of the PYTHIA event generator.
+// Copyright (C) 2021 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// Keywords: heavy ions; angantyr; Bose-Einstein; deuterons; timing;
+
+// This test program generates Pb-Pb collisions at sqrt(S_NN)=5.02TeV
+// using the Angantyr model, and compares the CPU time spent on
+// Bose-Einstein shifts and deuteron production when all pairs of
+// particles are considered, and when only pairs with a small relative
+// momentum are found in a sweep over rapidity.
+
+#include "Pythia8/Pythia.h"
+#include <time.h>
+
+using namespace Pythia8;
+
+//==========================================================================
+
+// Generate events for a given setup and return the CPU time used.
+
+double runTime(int iSetup, int nEvent, double& nDeut) {
+
+  Pythia pythia;
+
+  // Setup the beams.
+  pythia.readString("Beams:idA = 1000822080");
+  pythia.readString("Beams:idB = 1000822080");
+  pythia.readString("Beams:eCM = 5020.0");
+  pythia.readString("Beams:frameType = 1");
+
+  // Use default parameters for the Angantyr model, without fitting.
+  pythia.readString("HeavyIon:SigFitNGen = 0");
+  pythia.readString("HeavyIon:SigFitDefPar = "
+                    "17.24,2.15,0.33,0.0,0.0,0.0,0.0,0.0");
+
+  // Same random numbers for all setups, and reduced printout.
+  pythia.readString("Random:setSeed = on");
+  pythia.readString("Random:seed = 4711");
+  pythia.readString("Next:numberCount = 0");
+
+  // The afterburners: off, on for all pairs, or on with pair cuts.
+  if (iSetup > 0) {
+    pythia.readString("HadronLevel:BoseEinstein = on");
+    pythia.readString("HadronLevel:DeuteronProduction = on");
+  }
+  if (iSetup > 1) {
+    pythia.readString("BoseEinstein:QMaxRel = 10.");
+    pythia.readString("DeuteronProduction:kCut = 1.");
+  }
+  pythia.init();
+
+  // Generate events and measure the CPU time.
+  nDeut = 0.;
+  clock_t start = clock();
+  for (int iEvent = 0; iEvent < nEvent; ++iEvent) {
+    if (!pythia.next()) continue;
+    for (int i = 0; i < pythia.event.size(); ++i)
+      if (pythia.event[i].isFinal() && pythia.event[i].idAbs() == 1000010020)
+        ++nDeut;
+  }
+  clock_t stop = clock();
+  nDeut /= nEvent;
+  return double(stop - start) / CLOCKS_PER_SEC;
+
+}
+
+//==========================================================================
+
+int main() {
+
+  // Number of events per setup. Each event takes a few seconds.
+  int nEvent = 20;
+
+  // Run the three setups.
+  string names[3] = { "no afterburners", "all pairs", "pair cuts" };
+  double times[3], nDeut[3];
+  for (int iSetup = 0; iSetup < 3; ++iSetup)
+    times[iSetup] = runTime(iSetup, nEvent, nDeut[iSetup]);
+
+  // Print the timing comparison. The afterburner time is estimated
+  // as the difference to the run without afterburners.
+  cout << "\n *-------  Afterburner timing for " << nEvent
+       << " Pb-Pb events  -------*\n"
+       << " |                                              |\n"
+       << " | setup            total (s)  extra (s)  <nd>  |\n";
+  for (int iSetup = 0; iSetup < 3; ++iSetup)
+    cout << " | " << left << setw(16) << names[iSetup] << right
+         << fixed << setprecision(2) << setw(10) << times[iSetup]
+         << setw(11) << times[iSetup] - times[0]
+         << setw(6) << setprecision(1) << nDeut[iSetup] << "  |\n";
+  cout << " |                                              |\n"
+       << " *----------------------------------------------*" << endl;
+
+  // Done.
+  return 0;
+}
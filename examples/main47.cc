@@ -0,0 +1,108 @@
+// main47.cc is a part of the PYTHIA event generator.
+// Copyright (C) 2021 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// Keywords: binary event file; hadronization; timing;
+
+// This program illustrates how parton-level events can be stored in the
+// compact binary format of include/Pythia8Plugins/BinaryEventFile.h,
+// and later read back and hadronized with forceHadronLevel.
+// The time and space used for writing are printed, and the restored
+// event records are checked against the original ones.
+
+#include "Pythia8/Pythia.h"
+#include "Pythia8Plugins/BinaryEventFile.h"
+#include <time.h>
+
+using namespace Pythia8;
+
+//==========================================================================
+
+// A simple checksum of an event record.
+
+double checkSum(const Event& event) {
+  double sum = event.scale();
+  for (int i = 0; i < event.size(); ++i)
+    sum += (i + 1) * (event[i].id() + 3. * event[i].status()
+      + 5. * event[i].mother1() + 7. * event[i].daughter2()
+      + 11. * event[i].col() + event[i].px() + event[i].pz() + event[i].m()
+      + event[i].scale() + event[i].tProd());
+  for (int i = 0; i < event.sizeJunction(); ++i)
+    sum += event.kindJunction(i) + event.colJunction(i, 2);
+  return sum;
+}
+
+//==========================================================================
+
+int main() {
+
+  // Number of events and output file.
+  int nEvent = 2000;
+  string fileName = "main47.pyevb";
+
+  // Generate QCD jet events, stopped before hadronization.
+  Pythia pythia;
+  pythia.readString("Beams:eCM = 13000.");
+  pythia.readString("HardQCD:all = on");
+  pythia.readString("PhaseSpace:pTHatMin = 50.");
+  pythia.readString("HadronLevel:all = off");
+  pythia.readString("Next:numberCount = 0");
+  if (!pythia.init()) return 1;
+
+  // Generate events and write them to file.
+  vector<double> sumsIn;
+  double timeWrite = 0.;
+  BinaryEventWriter writer(fileName);
+  for (int iEvent = 0; iEvent < nEvent; ++iEvent) {
+    if (!pythia.next()) continue;
+    sumsIn.push_back(checkSum(pythia.event));
+    clock_t start = clock();
+    writer.write(pythia);
+    timeWrite += double(clock() - start) / CLOCKS_PER_SEC;
+  }
+  clock_t start = clock();
+  writer.close();
+  timeWrite += double(clock() - start) / CLOCKS_PER_SEC;
+
+  // Read the events back, check them, and hadronize them.
+  BinaryEventReader reader(fileName);
+  int nRead = 0, nBad = 0, nFail = 0;
+  double nCharged = 0., timeRead = 0.;
+  while (true) {
+    start = clock();
+    bool ok = reader.next(pythia.event);
+    timeRead += double(clock() - start) / CLOCKS_PER_SEC;
+    if (!ok) break;
+    if (abs(checkSum(pythia.event) - sumsIn[nRead]) > 1e-6
+      * abs(sumsIn[nRead])) ++nBad;
+    ++nRead;
+    // The junctions are stored in the file, so need not be searched for.
+    if (!pythia.forceHadronLevel(false)) { ++nFail; continue; }
+    for (int i = 0; i < pythia.event.size(); ++i)
+      if (pythia.event[i].isFinal() && pythia.event[i].isCharged())
+        ++nCharged;
+  }
+
+  // Random access to a single event. The event record needs access
+  // to the particle data table.
+  Event event;
+  event.init("(random access)", &pythia.particleData);
+  bool okRandom = reader.read(nRead / 2, event)
+    && abs(checkSum(event) - sumsIn[nRead / 2]) < 1e-6
+    * abs(sumsIn[nRead / 2]);
+
+  // Summary.
+  cout << "\n Wrote " << writer.nEvents() << " events, " << fixed
+       << setprecision(1) << double(writer.bytesWritten()) / nRead
+       << " bytes per event, in " << setprecision(3) << timeWrite
+       << " s.\n Read " << nRead << " events in " << timeRead << " s, "
+       << nBad << " differing from the original, random access "
+       << (okRandom ? "ok" : "failed") << ".\n Hadronized with "
+       << nFail << " failures, <nCharged> = " << setprecision(1)
+       << nCharged / max(1, nRead - nFail) << ".\n" << endl;
+  pythia.stat();
+
+  // Done.
+  return 0;
+}
@@ -0,0 +1,93 @@
+// main49.cc is a part of the PYTHIA event generator.
+// Copyright (C) 2021 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// Keywords: hepmc; timing;
+
+// This program compares the CPU time spent on converting PYTHIA events
+// to HepMC3 and writing them to file, for the default conversion and
+// for the lighter options of include/Pythia8Plugins/HepMC3.h:
+// reusing the GenEvent without storing the colour flow, and storing
+// only the final state together with the hardest process.
+// Give "pPb" or "PbPb" as argument to run with heavy-ion beams.
+
+#include "Pythia8/Pythia.h"
+#include "Pythia8Plugins/HepMC3.h"
+#include <time.h>
+
+using namespace Pythia8;
+
+//==========================================================================
+
+int main(int argc, char* argv[]) {
+
+  // Number of events and choice of beams.
+  int nEvent = 200;
+  string beams = (argc > 1) ? argv[1] : "pp";
+
+  // Generate minimum-bias events at LHC energies.
+  Pythia pythia;
+  if (beams == "pPb" || beams == "PbPb") {
+    nEvent = 20;
+    pythia.readString("Beams:idB = 1000822080");
+    if (beams == "PbPb") pythia.readString("Beams:idA = 1000822080");
+    pythia.readString("Beams:eCM = 5020.");
+    pythia.readString("Beams:frameType = 1");
+    pythia.readString("HeavyIon:SigFitNGen = 0");
+    pythia.readString("HeavyIon:SigFitDefPar = "
+                      "17.24,2.15,0.33,0.0,0.0,0.0,0.0,0.0");
+  } else {
+    pythia.readString("Beams:eCM = 13000.");
+    pythia.readString("SoftQCD:nonDiffractive = on");
+  }
+  pythia.readString("Next:numberCount = 0");
+  if (!pythia.init()) return 1;
+
+  // The three conversion setups, each writing to its own file.
+  const int nSetup = 3;
+  string names[nSetup] = { "default", "reuse, no flow", "final state" };
+  Pythia8ToHepMC toHepMC[nSetup];
+  for (int iSetup = 0; iSetup < nSetup; ++iSetup)
+    toHepMC[iSetup].setNewFile("main49_" + to_string(iSetup) + ".hepmc");
+  toHepMC[1].setReuseEvent();
+  toHepMC[1].set_store_flow(false);
+  toHepMC[2].setReuseEvent();
+  toHepMC[2].set_store_flow(false);
+  toHepMC[2].set_final_state_only(true, {21, 22, 23});
+
+  // Generate events and time the conversion and output of each setup.
+  double timeFill[nSetup] = {0.}, timeWrite[nSetup] = {0.};
+  double nStored[nSetup] = {0.};
+  int nAcc = 0;
+  for (int iEvent = 0; iEvent < nEvent; ++iEvent) {
+    if (!pythia.next()) continue;
+    ++nAcc;
+    for (int iSetup = 0; iSetup < nSetup; ++iSetup) {
+      clock_t start = clock();
+      toHepMC[iSetup].fillNextEvent(pythia);
+      clock_t mid = clock();
+      toHepMC[iSetup].writeEvent();
+      clock_t stop = clock();
+      timeFill[iSetup]  += double(mid - start) / CLOCKS_PER_SEC;
+      timeWrite[iSetup] += double(stop - mid) / CLOCKS_PER_SEC;
+      nStored[iSetup]   += toHepMC[iSetup].event().particles().size();
+    }
+  }
+
+  // Print the timing comparison.
+  cout << "\n *-------  HepMC3 output for " << nAcc << " " << setw(4)
+       << beams << " events  ---------------*\n"
+       << " |                                                    |\n"
+       << " | setup             fill (s)  write (s)  particles   |\n";
+  for (int iSetup = 0; iSetup < nSetup; ++iSetup)
+    cout << " | " << left << setw(16) << names[iSetup] << right
+         << fixed << setprecision(3) << setw(9) << timeFill[iSetup]
+         << setw(11) << timeWrite[iSetup] << setw(11) << setprecision(1)
+         << nStored[iSetup] / max(1, nAcc) << "   |\n";
+  cout << " |                                                    |\n"
+       << " *----------------------------------------------------*" << endl;
+
+  // Done.
+  return 0;
+}
@@ -540,6 +540,11 @@ protected:
   vector<double> diB;
   vector<double> dij;
 
+  // Nearest-neighbour cache: for each cluster i the smallest dij with
+  // j < i, and the first such j (-1 if none).
+  vector<double> dNN;
+  vector<int>    jNN;
+
   // Other intermediate variables.
   int    origSize, clSize, clLast, jtSize, iMin, jMin;
   double dPhi, dijTemp, dMin;
@@ -547,6 +552,12 @@ protected:
   // Find next cluster pair to join.
   virtual void findNext();
 
+  // Find or update the nearest neighbour of cluster i.
+  void findNN(int i);
+  void updateNN(int i, int j) { double dijNow = dij[i*(i-1)/2 + j];
+    if (dijNow < dNN[i] || (dijNow == dNN[i] && j < jNN[i])) {
+    dNN[i] = dijNow; jNN[i] = j;} }
+
   // Use FJcore interface to perform clustering.
   bool clusterFJ();
 
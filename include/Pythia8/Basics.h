@@ -279,7 +279,7 @@ public:
   void reset();
 
   // Return value of matrix element.
-  double value(int i, int j) { return M[i][j];}
+  double value(int i, int j) const { return M[i][j];}
 
   // Crude estimate deviation from unit matrix.
   double deviation() const;
@@ -475,6 +475,12 @@ public:
   // Fill bin with weight.
   void fill(double x, double w = 1.) ;
 
+  // Fill several values at once, with a common weight or one each.
+  void fill(const vector<double>& x, double w = 1.) {
+    fillBatch( x.data(), 0, w, int(x.size()));}
+  void fill(const vector<double>& x, const vector<double>& w) {
+    fillBatch( x.data(), w.data(), 1., int(min( x.size(), w.size())));}
+
   // Print a histogram with overloaded << operator.
   friend ostream& operator<<(ostream& os, const Hist& h) ;
 
@@ -589,7 +595,7 @@ public:
 private:
 
   // Constants: could only be changed in the code itself.
-  static const int    NBINMAX, NCOLMAX, NLINES;
+  static const int    NBINMAX, NCOLMAX, NLINES, NBATCH;
   static const double TOLERANCE, TINY, LARGE, SMALLFRAC, DYAC[];
   static const char   NUMBER[];
 
@@ -601,6 +607,9 @@ private:
   double dx, under, inside, over, sumxw;
   vector<double> res;
 
+  // Fill n values, with weights w, or wAll for all if w is null.
+  void fillBatch(const double* x, const double* w, double wAll, int n);
+
 };
 
 //--------------------------------------------------------------------------
@@ -624,6 +633,62 @@ Hist operator/(double f, const Hist& h1);
 
 //==========================================================================
 
+// SharedHist class.
+// A histogram that can be filled from several threads at the same time.
+// Each thread fills a Hist of its own, created at its first fill, and
+// these are summed when the result is read. Reading and resetting
+// should only be done when no other thread is filling.
+
+class SharedHist {
+
+public:
+
+  // Constructors.
+  SharedHist(string titleIn = "  ", int nBinIn = 100, double xMinIn = 0.,
+    double xMaxIn = 1., bool logXIn = false) : histSave(titleIn, nBinIn,
+    xMinIn, xMaxIn, logXIn), idSave(nextId++) { }
+  SharedHist(const Hist& histIn) : histSave(histIn), idSave(nextId++) { }
+
+  // Fill bin with weight, in the histogram of the current thread.
+  void fill(double x, double w = 1.) { shard().fill( x, w);}
+  void fill(const vector<double>& x, double w = 1.) { shard().fill( x, w);}
+  void fill(const vector<double>& x, const vector<double>& w) {
+    shard().fill( x, w);}
+
+  // Sum of the histograms of all threads. Can be used wherever a Hist
+  // is expected, e.g. for printing or in HistPlot.
+  Hist result() const;
+  operator Hist() const { return result();}
+
+  // Reset bin contents, in all threads.
+  void null();
+
+  // Number of threads that have filled the histogram.
+  int nThreads() const { lock_guard<mutex> lock(mtx);
+    return shards.size();}
+
+private:
+
+  // Counter to give each histogram its own identifier. The identifiers
+  // are never reused, so that the map entries that threads keep for a
+  // histogram that has been destroyed can never be found by a new one.
+  static atomic<long long> nextId;
+
+  // The booked histogram, with any contents it was created with.
+  Hist      histSave;
+  long long idSave;
+
+  // The histograms of the individual threads, with a lock for adding one.
+  deque<Hist>   shards;
+  mutable mutex mtx;
+
+  // Find the histogram of the current thread, or create it.
+  Hist& shard();
+
+};
+
+//==========================================================================
+
 // HistPlot class.
 // Writes a Python program that can generate PDF plots from Hist histograms.
 
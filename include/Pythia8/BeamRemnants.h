@@ -95,6 +95,16 @@ private:
   // Select the flavours/kinematics/colours of the two beam remnants.
   bool addNew( Event& event);
 
+  // Saved event, beams and parton systems, to restore after failures.
+  Event         eventSave, eventTmpSave;
+  BeamParticle  beamAsave, beamBsave;
+  PartonSystems partonSystemsSave;
+
+  // Restore the event, beams and parton systems saved at the start of add.
+  void restoreSaved( Event& event) { event.restoreCheckpoint( eventSave);
+    *beamAPtr = beamAsave; *beamBPtr = beamBsave;
+    *partonSystemsPtr = partonSystemsSave;}
+
   // Pointer to assign space-time information.
   PartonVertexPtr partonVertexPtr;
   bool doPartonVertex;
@@ -50,7 +50,7 @@ class BoseEinstein : public PhysicsBase {
 public:
 
   // Constructor.
-  BoseEinstein() : doPion(), doKaon(), doEta(), lambda(), QRef(),
+  BoseEinstein() : doPion(), doKaon(), doEta(), lambda(), QRef(), QMax(),
     nStep(), nStep3(), nStored(), QRef2(), QRef3(), R2Ref(), R2Ref2(),
     R2Ref3(), mHadron(), mPair(), m2Pair(), deltaQ(), deltaQ3(), maxQ(),
     maxQ3(), shift(), shift3() {}
@@ -69,7 +69,7 @@ private:
 
   // Initialization data, read from Settings.
   bool   doPion, doKaon, doEta;
-  double lambda, QRef;
+  double lambda, QRef, QMax;
 
   // Table of momentum shifts for different hadron species.
   int    nStep[4], nStep3[4], nStored[10];
@@ -80,6 +80,9 @@ private:
   // Vector of hadrons to study.
   vector<BoseEinsteinHadron> hadronBE;
 
+  // Calculate shifts for the pairs in a range of hadrons with Q < QMax.
+  void shiftNearPairs(int iBeg, int iEnd, int iTab);
+
   // Calculate shift and (unnormalized) compensation for pair.
   void shiftPair(int i1, int i2, int iHad);
 
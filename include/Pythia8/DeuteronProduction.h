@@ -25,7 +25,7 @@ public:
 
   // Constructor.
   DeuteronProduction() : valid(true), models(), ids(), parms(), masses(),
-    norm(), mPion(), mSafety(), kMin(), kMax(), kTol(), kSteps() {}
+    norm(), mPion(), mSafety(), kMin(), kMax(), kTol(), kCut(), kSteps() {}
 
   // Find settings. Precalculate table used to find momentum shifts.
   bool init();
@@ -43,6 +43,7 @@ private:
   double mPion;                          // Mass of the pion.
   double mSafety;                        // Safety margin for decays.
   double kMin, kMax, kTol;               // Bracketing/tolerance in k for max.
+  double kCut;                           // Largest k that can bind, if > 0.
   int kSteps;                            // Number of steps for grid search.
 
   // Constants: could only be changed in the code itself.
@@ -55,6 +56,9 @@ private:
   // Build the nucleon-pair combinations and shuffle.
   void combos(Event& event, vector<int>& prts, vector<pair<int, int> > &cmbs);
 
+  // Relative momentum of a nucleon pair in its rest frame.
+  double kRel(Vec4 p0, Vec4 p1);
+
   // Single pion final state fit, equations 10/13/14 of arXiv:1504.07242.
   double fit(double k, vector<double>& c, int i);
 
@@ -190,6 +190,7 @@ public:
     pTdampFudge         = 0.;
     mergingHooksPtr     = nullptr;
     splittingsPtr       = nullptr;
+    splittingNow        = nullptr;
     weights             = 0;
     direInfoPtr         = nullptr;
     beamAPtr = beamBPtr = nullptr;
@@ -220,6 +221,7 @@ public:
       beamOffset        = 0;
       pTdampFudge       = 0.;
       splittingsPtr     = nullptr;
+      splittingNow      = nullptr;
       weights           = 0;
       direInfoPtr       = nullptr;
       printBanner       = true;
@@ -238,6 +240,7 @@ public:
 
   bool initSplits() {
     if (splittingsPtr) splits = splittingsPtr->getSplittings();
+    setSplittingDispatch();
     return (splits.size() > 0);
   }
 
@@ -719,8 +722,8 @@ private:
   unordered_map<int,int> nProposedPT;
 
   // Return headroom factors for integrated/differential overestimates.
-  double overheadFactors( string, int, bool, double, double);
-  double enhanceOverestimateFurther( string, int, double );
+  double overheadFactors( const string&, int, bool, double, double);
+  double enhanceOverestimateFurther( const string&, int, double );
 
   // Function to fill map of integrated overestimates.
   void getNewOverestimates( int, DireSpaceEnd*, const Event&, double,
@@ -810,6 +813,20 @@ private:
 
   bool doVariations;
 
+  // Dispatch table of splitting kernels, filled whenever the splittings are
+  // (re)set. The kernels are stored in a fixed order, and for each radiator
+  // type (0: initial state, 1: final state) the indices of the kernels that
+  // can act on it are listed, so that the dipole loops neither test every
+  // kernel nor hash kernel names. Kernels that are flagged neither as FSR
+  // nor as ISR are listed for both radiator types.
+  void setSplittingDispatch();
+  vector<DireSplitting*> splitList;
+  vector<string> splitNames;
+  vector<int> splitDispatch[2];
+
+  // The splitting kernel currently being tried.
+  DireSplitting* splittingNow;
+
   // Dynamically adjustable overestimate factors.
   unordered_map<string, double > overhead;
   void scaleOverheadFactor(string name, double scale) {
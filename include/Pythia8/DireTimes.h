@@ -218,6 +218,7 @@ public:
     beamOffset        = 0;
     userHooksPtr      = nullptr;
     splittingsPtr     = nullptr;
+    splittingNow      = nullptr;
     weights           = 0;
     direInfoPtr       = nullptr;
     printBanner       = true;
@@ -237,6 +238,7 @@ public:
 
   bool initSplits() {
     if (splittingsPtr) splits = splittingsPtr->getSplittings();
+    setSplittingDispatch();
     return (splits.size() > 0);
   }
 
@@ -698,9 +700,9 @@ private:
   unordered_map<int,int> nProposedPT;
 
   // Return headroom factors for integrated/differential overestimates.
-  double overheadFactors(DireTimesEnd*, const Event&, string, double,
+  double overheadFactors(DireTimesEnd*, const Event&, const string&, double,
     double, double);
-  double enhanceOverestimateFurther( string, int, double );
+  double enhanceOverestimateFurther( const string&, int, double );
   double overheadFactorsMEC(const Event&, DireSplitInfo*, string);
 
   // Function to fill map of integrated overestimates.
@@ -796,6 +798,20 @@ private:
 
   // List of splitting kernels.
   //map<string, DireSplitting* > splits;
+
+  // Dispatch table of splitting kernels, filled whenever the splittings are
+  // (re)set. The kernels are stored in a fixed order, and for each radiator
+  // type (0: initial state, 1: final state) the indices of the kernels that
+  // can act on it are listed, so that the dipole loops neither test every
+  // kernel nor hash kernel names. Kernels that are flagged neither as FSR
+  // nor as ISR are listed for both radiator types.
+  void setSplittingDispatch();
+  vector<DireSplitting*> splitList;
+  vector<string> splitNames;
+  vector<int> splitDispatch[2];
+
+  // The splitting kernel currently being tried.
+  DireSplitting* splittingNow;
   unordered_map<string, double > overhead;
   void scaleOverheadFactor(string name, double scale) {
     overhead[name] *= scale;
@@ -96,8 +96,8 @@ public:
   // Initialize weights.
   void init() {
     reset();
-    for ( unordered_map<string, double>::iterator itw = showerWeight.begin();
-      itw != showerWeight.end(); ++itw ) itw->second = 1.;
+    for (int i = 0; i < int(showerWeightVal.size()); ++i)
+      showerWeightVal[i] = 1.;
   }
   void setup();
 
@@ -113,38 +113,60 @@ public:
 
   // Reset current accept/reject probabilities.
   void reset() {
-    for ( unordered_map<string, map<ulong, DirePSWeight> >::iterator
-      it = rejectWeight.begin(); it != rejectWeight.end(); ++it )
-      it->second.clear();
-    for ( unordered_map<string, map<ulong, DirePSWeight> >::iterator
-      it = acceptWeight.begin(); it != acceptWeight.end(); ++it )
-      it->second.clear();
+    for (int i = 0; i < int(rejectWeight.size()); ++i) {
+      rejectWeight[i].clear();
+      acceptWeight[i].clear();
+    }
   }
   void clear() {
     reset();
-    for ( unordered_map<string, double >::iterator it = showerWeight.begin();
-      it != showerWeight.end(); ++it ) it->second = 1.0;
+    for (int i = 0; i < int(showerWeightVal.size()); ++i)
+      showerWeightVal[i] = 1.0;
   }
 
   // Function to initialize new maps for a new shower variation.
   void bookWeightVar(string varKey, bool checkSettings = true);
 
+  // Dense index of a booked shower variation, or -1 if not booked.
+  int weightIndex(const string& varKey) const {
+    unordered_map<string,int>::const_iterator it = weightIndices.find(varKey);
+    return (it == weightIndices.end()) ? -1 : it->second;
+  }
+
   // To avoid rounding problems, maps will be indexed with long keys.
   // Round double inputs to four decimals, as long will should be >10 digits.
   ulong key(double a) { return (ulong)(a*1e8+0.5); }
   double dkey(ulong a) { return (double(a)/1e8); }
 
-  void setWeight( string varKey, double value);
-  void resetAcceptWeight( double pT2key, double value, string varKey);
-  void resetRejectWeight( double pT2key, double value, string varKey);
-  void eraseAcceptWeight( double pT2key, string varKey);
-  void eraseRejectWeight( double pT2key, string varKey);
-  double getAcceptWeight( double pT2key, string varKey);
-  double getRejectWeight( double pT2key, string varKey);
+  // Access to the weights of a variation, by name or by dense index.
+  void setWeight( const string& varKey, double value) {
+    setWeight( weightIndex(varKey), value);}
+  void resetAcceptWeight( double pT2key, double value, const string& varKey)
+    { resetAcceptWeight( pT2key, value, weightIndex(varKey));}
+  void resetRejectWeight( double pT2key, double value, const string& varKey)
+    { resetRejectWeight( pT2key, value, weightIndex(varKey));}
+  void eraseAcceptWeight( double pT2key, const string& varKey) {
+    eraseAcceptWeight( pT2key, weightIndex(varKey));}
+  void eraseRejectWeight( double pT2key, const string& varKey) {
+    eraseRejectWeight( pT2key, weightIndex(varKey));}
+  double getAcceptWeight( double pT2key, const string& varKey) {
+    return getAcceptWeight( pT2key, weightIndex(varKey));}
+  double getRejectWeight( double pT2key, const string& varKey) {
+    return getRejectWeight( pT2key, weightIndex(varKey));}
+  void setWeight( int iVar, double value);
+  void resetAcceptWeight( double pT2key, double value, int iVar);
+  void resetRejectWeight( double pT2key, double value, int iVar);
+  void eraseAcceptWeight( double pT2key, int iVar);
+  void eraseRejectWeight( double pT2key, int iVar);
+  double getAcceptWeight( double pT2key, int iVar);
+  double getRejectWeight( double pT2key, int iVar);
 
   // Attach accept/reject probabilities for a proposed shower step.
-  void insertWeights( map<double,double> aWeight,
-    multimap<double,double> rWeight, string varKey );
+  void insertWeights( const map<double,double>& aWeight,
+    const multimap<double,double>& rWeight, const string& varKey ) {
+    insertWeights( aWeight, rWeight, weightIndex(varKey));}
+  void insertWeights( const map<double,double>& aWeight,
+    const multimap<double,double>& rWeight, int iVar );
 
   // Function to calculate the weight of the shower evolution step.
   void calcWeight(double pT2, bool includeAcceptAtPT2 = true,
@@ -155,8 +177,8 @@ public:
   // Function to return weight of the shower evolution.
   double getShowerWeight(string valKey = "base") {
     // First try to return an individual shower weight indexed by "valKey".
-    unordered_map<string, double>::iterator it1 = showerWeight.find( valKey );
-    if ( it1 != showerWeight.end() ) return it1->second;
+    int iVar = weightIndex(valKey);
+    if (iVar >= 0) return showerWeightVal[iVar];
 
     // If not possible, return a product of shower weights indexed by "valKey".
     unordered_map<string, vector<string> >::iterator it2
@@ -165,9 +187,8 @@ public:
       double wtNow = 1.;
       // Loop through group of weights and combine all weights into one weight.
       for (int iwgtname=0; iwgtname < int(it2->second.size()); ++iwgtname) {
-        unordered_map<string, double>::iterator it3
-          = showerWeight.find( it2->second[iwgtname] );
-       if ( it3 != showerWeight.end() ) wtNow *= it3->second;
+        int iVarNow = weightIndex(it2->second[iwgtname]);
+        if (iVarNow >= 0) wtNow *= showerWeightVal[iVarNow];
       }
       return wtNow;
     }
@@ -175,8 +196,13 @@ public:
     return 0.;
   }
 
-  unordered_map<string,double>* getShowerWeights() { return &showerWeight; }
-  double sizeWeights() const { return showerWeight.size(); }
+  // Named shower weights, filled from the indexed weights on request.
+  unordered_map<string,double>* getShowerWeights() {
+    for (int i = 0; i < int(weightNames.size()); ++i)
+      showerWeight[weightNames[i]] = showerWeightVal[i];
+    return &showerWeight;
+  }
+  double sizeWeights() const { return weightNames.size(); }
   string weightName (int i) const  { return weightNames[i]; }
 
   double sizeWeightgroups() const { return weightCombineList.size(); }
@@ -208,10 +234,15 @@ private:
 
   Settings* settingsPtr;
 
-  unordered_map<string, map<ulong, DirePSWeight> > acceptWeight;
-  unordered_map<string, map<ulong, DirePSWeight> > rejectWeight;
-  unordered_map<string, double> showerWeight;
+  // Shower variations are booked once, to dense indices into the vectors
+  // below. Accept and reject weights of trial emissions are kept per
+  // variation, keyed by the rounded evolution scale of the trial, and are
+  // folded into the shower weight of the variation by calcWeight.
+  unordered_map<string,int> weightIndices;
   vector<string> weightNames;
+  vector< map<ulong,double> > acceptWeight, rejectWeight;
+  vector<double> showerWeightVal;
+  unordered_map<string, double> showerWeight;
   unordered_map<string, vector<string> > weightCombineList;
   vector<string> weightCombineListNames;
 
@@ -539,11 +539,11 @@ public:
   double REtaPhi(int i1, int i2) const {
     return sqrt( pow2(detaAbs(i1, i2)) + pow2(dphiAbs(i1, i2)) ); }
 
-  // Member functions for rotations and boosts of an event.
-  void rot(double theta, double phi)
-    {for (int i = 0; i < size(); ++i) entry[i].rot(theta, phi);}
-  void bst(double betaX, double betaY, double betaZ)
-    {for (int i = 0; i < size(); ++i) entry[i].bst(betaX, betaY, betaZ);}
+  // Member functions for rotations and boosts of an event. For the first
+  // two the trigonometric functions or the gamma factor are only
+  // evaluated once for the whole event.
+  void rot(double theta, double phi);
+  void bst(double betaX, double betaY, double betaZ);
   void bst(double betaX, double betaY, double betaZ, double gamma)
     {for (int i = 0; i < size(); ++i) entry[i].bst(betaX, betaY, betaZ,
     gamma);}
@@ -584,6 +584,13 @@ public:
   // List any junctions in the event; for debug mainly.
   void listJunctions() const;
 
+  // Save a checkpoint of the event record in another event, and later
+  // roll back to it. Unlike assignment the memory of the checkpoint is
+  // reused between calls, so no allocation is needed for retries.
+  // The checkpoint should only be restored into the event it came from.
+  void saveCheckpoint(Event& checkpoint) const;
+  void restoreCheckpoint(const Event& checkpoint);
+
   // Save event record size at Parton Level, i.e. before hadronization.
   void savePartonLevelSize() {savedPartonLevelSize = entry.size();}
 
@@ -630,6 +637,57 @@ private:
 
 //==========================================================================
 
+// The EventMomenta class holds the momenta, masses and production vertices
+// of an event record as separate contiguous arrays. Loops over the whole
+// event, like Lorentz transformations and momentum sums, can then be
+// vectorized by the compiler, and read only the data they need.
+// The arrays are public, to be used directly in analysis loops.
+
+class EventMomenta {
+
+public:
+
+  // Constructors.
+  EventMomenta() {}
+  EventMomenta(const Event& event, bool withVertices = true) {
+    fill( event, withVertices);}
+
+  // Copy from an event record, or back into the same event record.
+  // Without vertices the vertex arrays are left empty and not stored.
+  void fill(const Event& event, bool withVertices = true);
+  void store(Event& event) const;
+
+  // Number of particles, and momentum and vertex of a particle.
+  int  size() const {return int(e.size());}
+  Vec4 p(int i) const {return Vec4( px[i], py[i], pz[i], e[i]);}
+  Vec4 vProd(int i) const {return (tProd.size() == 0) ? Vec4()
+    : Vec4( xProd[i], yProd[i], zProd[i], tProd[i]);}
+
+  // Rotations and boosts of all momenta and existing vertices, with the
+  // same results as the corresponding Event methods.
+  void rot(double theta, double phi);
+  void bst(double betaX, double betaY, double betaZ);
+  void bst(double betaX, double betaY, double betaZ, double gamma);
+  void rotbst(const RotBstMatrix& M);
+
+  // Sum of momenta, by default of final-state particles only.
+  Vec4 pSum(bool onlyFinal = true) const;
+
+  // The arrays, with status codes to select particles.
+  vector<double> px, py, pz, e, m, xProd, yProd, zProd, tProd;
+  vector<int>    status;
+  vector<char>   hasVertex;
+
+private:
+
+  // Apply a transformation to all momenta, and then to all vertices.
+  // The kernel is called with pointers to the four component arrays.
+  template<typename Kernel> void transform(Kernel kernel);
+
+};
+
+//==========================================================================
+
 } // end namespace Pythia8
 
 #endif // Pythia8_Event_H
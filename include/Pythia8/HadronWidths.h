@@ -57,6 +57,9 @@ public:
   // Get the branching ratio for the specified decay channel of the particle.
   double br(int idR, int prodA, int prodB, double m) const;
 
+  // Get the branching ratio and also return the total width.
+  double br(int idR, int prodA, int prodB, double m, double& widthOut) const;
+
   // Get the mass distribution density for the particle at the specified mass.
   double mDistr(int id, double m) const;
 
@@ -110,6 +113,36 @@ private:
   // Map from particle id to corresponding HadronWidthEntry.
   map<int, HadronWidthEntry> entries;
 
+  // Cumulative running-width Breit-Wigner, tabulated in the variable
+  // atan(2 (m - m0) / Gamma0), relative to the fixed-width Breit-Wigner.
+  struct MassTable {
+    double m0, gamma0, bwMin, dbw;
+    vector<double> wts, cumul;
+  };
+
+  // Cumulative partial widths of all channels at each interpolation point.
+  struct DecayTable {
+    vector<const ResonanceDecayChannel*> channels;
+    vector<double> cumul;
+  };
+
+  // Lazily built tables for mass and decay channel selection.
+  bool useMassTables = false;
+  map<int, MassTable>  massTables;
+  map<int, DecayTable> decayTables;
+
+  // Get tables, building them the first time they are asked for.
+  // Return nullptr if the tables cannot be used for the particle.
+  const MassTable*  massTable(int idAbs, const HadronWidthEntry& entry);
+  const DecayTable* decayTable(int idAbs, const HadronWidthEntry& entry);
+
+  // Sample a mass below mMaxNow from a tabulated mass distribution.
+  double pickMassTab(const MassTable& table, double mMaxNow);
+
+  // Pick a decay channel from tabulated partial widths.
+  const ResonanceDecayChannel* pickChannelTab(int idAbs,
+    const HadronWidthEntry& entry, double m);
+
   // Gets key for the decay and flips idR if necessary
   pair<int, int> getKey(int& idR, int idA, int idB) const;
 
@@ -101,17 +101,23 @@ protected:
 
 private:
 
-  // Recursive sub-method to calculate the density matrix for a particle.
-  void calculateRho(unsigned int, vector<HelicityParticle>&,
-    vector<int>&, vector<int>&, unsigned int);
+  // Matrix element for each helicity configuration, and table strides.
+  vector< complex > amps;
+  vector< int > hStride;
 
-  // Recursive sub-method to calculate the decay matrix for a particle.
-  void calculateD(vector<HelicityParticle>&, vector<int>&, vector<int>&,
-    unsigned int);
+  // The current pair of helicity configurations in the helicity sums.
+  vector< int > hel1, hel2;
 
-  // Recursive sub-method to calculate the matrix element weight for a decay.
-  void decayWeight(vector<HelicityParticle>&, vector<int>&, vector<int>&,
-    complex&, unsigned int);
+  // Tabulate the matrix element for all helicity configurations.
+  bool calculateAmplitudes(vector<HelicityParticle>&);
+
+  // Step to the next pair of helicity configurations.
+  bool nextHelicities(vector<HelicityParticle>&);
+
+  // Index of a helicity configuration in the matrix element table.
+  int ampIndex(vector<int>& h) {int iAmp = 0;
+    for (int i = 0; i < int(h.size()); ++i) iAmp += h[i] * hStride[i];
+    return iAmp;}
 
   // Calculate the product of the decay matrices for a hard process.
   complex calculateProductD(unsigned int, unsigned int,
@@ -95,6 +95,35 @@ public:
 
 //==========================================================================
 
+// Declaration of TrialShowerWorker class.
+// This class holds pointers to the objects of a cloned Pythia instance
+// that are needed to perform trial showers for the History class, so that
+// independent trial showers can run on separate threads.
+
+class TrialShowerWorker {
+
+public:
+
+  // Constructor.
+  TrialShowerWorker(PartonLevel* trialPtrIn = nullptr,
+    Info* infoPtrIn = nullptr, MergingHooksPtr mergingHooksPtrIn = nullptr,
+    ParticleData* particleDataPtrIn = nullptr, Rndm* rndmPtrIn = nullptr)
+    : trialPtr(trialPtrIn), infoPtr(infoPtrIn),
+      mergingHooksPtr(mergingHooksPtrIn), particleDataPtr(particleDataPtrIn),
+      rndmPtr(rndmPtrIn) {}
+
+  // Trial shower, information, merging hooks, particle data and random
+  // number generator of the worker.
+  PartonLevel*    trialPtr;
+  Info*           infoPtr;
+  MergingHooksPtr mergingHooksPtr;
+  ParticleData*   particleDataPtr;
+  Rndm*           rndmPtr;
+
+};
+
+//==========================================================================
+
 // Declaration of History class
 //
 // A History object represents an event in a given step in the CKKW-L
@@ -125,11 +154,11 @@ public:
   // previous history node (null for the initial node).
   History( int depthIn,
            double scalein,
-           Event statein,
+           const Event& statein,
            Clustering c,
            MergingHooksPtr mergingHooksPtrIn,
-           BeamParticle beamAIn,
-           BeamParticle beamBIn,
+           const BeamParticle& beamAIn,
+           const BeamParticle& beamBIn,
            ParticleData* particleDataPtrIn,
            Info* infoPtrIn,
            PartonLevel* showersIn,
@@ -159,8 +188,11 @@ public:
   //     PartonSystems*  : PartonSystems object needed to initialise
   //                       shower objects
   // OUT vector<double>  : (Sukadov) , (alpha_S ratios) , (PDF ratios)
+  //     vector<TrialShowerWorker>* : Optional workers to perform the
+  //                       trial showers of the selected path concurrently
   vector<double> weightCKKWL(PartonLevel* trial, AlphaStrong * asFSR,
-    AlphaStrong * asISR, AlphaEM * aemFSR, AlphaEM * aemISR, double RN);
+    AlphaStrong * asISR, AlphaEM * aemFSR, AlphaEM * aemISR, double RN,
+    vector<TrialShowerWorker>* workersPtr = nullptr);
 
 
   // For default NL3:
@@ -442,6 +474,14 @@ private:
   vector<double> doTrialShower(PartonLevel* trial, int type, double maxscale,
     double minscale = 0.);
 
+  // Perform the trial shower with the objects of a trial shower worker.
+  vector<double> doTrialShower(TrialShowerWorker& worker, int type,
+    double maxscale, double minscale);
+
+  // Perform all trial showers of the path from this node to the initial
+  // node on the trial shower workers, and store the results.
+  void doTrialShowers(vector<TrialShowerWorker>& workers, double maxscale);
+
   // Function to bookkeep the indices of weights generated in countEmissions
   bool updateind(vector<int> & ind, int i, int N);
 
@@ -500,21 +540,23 @@ private:
   //     Event : event record to be checked for ptential partners
   // OUT vector of all allowed radiator+recoiler+emitted triples
   vector<Clustering> findQCDTriple (int emtTagIn, int colTopIn,
-                       const Event& event, vector<int> posFinalPartn,
-                       vector <int> posInitPartn );
+                       const Event& event, const vector<int>& posFinalPartn,
+                       const vector<int>& posInitPartn );
 
   vector<Clustering> getAllEWClusterings();
   vector<Clustering> getEWClusterings( const Event& event);
   vector<Clustering> findEWTripleW( int emtTagIn, const Event& event,
-                       vector<int> posFinalPartn, vector<int> posInitPartn );
+                       const vector<int>& posFinalPartn,
+                       const vector<int>& posInitPartn );
   vector<Clustering> findEWTripleZ( int emtTagIn, const Event& event,
-                       vector<int> posFinalPartn, vector<int> posInitPartn );
+                       const vector<int>& posFinalPartn,
+                       const vector<int>& posInitPartn );
 
   vector<Clustering> getAllSQCDClusterings();
   vector<Clustering> getSQCDClusterings( const Event& event);
   vector<Clustering> findSQCDTriple (int emtTagIn, int colTopIn,
-                       const Event& event, vector<int> posFinalPartn,
-                       vector <int> posInitPartn );
+                       const Event& event, const vector<int>& posFinalPartn,
+                       const vector<int>& posInitPartn );
 
   // Function to attach (spin-dependent duplicates of) a clustering.
   void attachClusterings (vector<Clustering>& clus, int iEmt, int iRad,
@@ -551,6 +593,16 @@ private:
   // OUT clustered state
   Event cluster( Clustering & inSystem);
 
+  // Find the canonical ordering of the current state, where the final-state
+  // particles are sorted by their properties, and a key that identifies
+  // the state independently of the order of the final-state particles.
+  // OUT vector<double> : Key of the state
+  //     vector<int>    : Canonical position of each particle in the state
+  //     vector<int>    : Position in the state for each canonical position
+  //     bool           : False if the state cannot be shared
+  bool canonicalState( vector<double>& key, vector<int>& iCanon,
+    vector<int>& iInState);
+
   // Function to get the flavour of the radiator before the splitting
   // for clustering
   // IN  int   : Position of the radiator after the splitting, in the event
@@ -945,6 +997,25 @@ private:
     minDepthSave = (minDepthSave>0) ? min(minDepthSave,depthIn) : depthIn;
   }
 
+  // Clusterings of the states met in the construction of the history tree,
+  // in canonical positions, kept in the initial node for
+  // Merging:shareHistoryStates.
+  map< vector<double>, vector<Clustering> > sharedStatesSave;
+  vector<Clustering>& sharedClusterings(const vector<double>& key,
+    bool& isNew) {
+    if ( mother ) return mother->sharedClusterings(key, isNew);
+    map< vector<double>, vector<Clustering> >::iterator it
+      = sharedStatesSave.lower_bound(key);
+    isNew = (it == sharedStatesSave.end() || it->first != key);
+    if ( isNew ) it = sharedStatesSave.insert( it,
+      make_pair( key, vector<Clustering>() ) );
+    return it->second;
+  }
+
+  // No-emission weights of the trial showers of this node, for the shower
+  // type and the starting scale, when precomputed by trial shower workers.
+  map< pair<int,double>, vector<double> > trialShowerWeightsSave;
+
 };
 
 //==========================================================================
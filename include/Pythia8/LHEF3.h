@@ -825,14 +825,16 @@ public:
   // filename: the name of the file to read from.
   //
   Reader(string filenameIn)
-    : filename(filenameIn), intstream(NULL), file(NULL), version() {
+    : filename(filenameIn), intstream(NULL), file(NULL), nEventsRead(0),
+      bytesReadSave(0.), timeReadSave(0.), hasIndex(false), version() {
     intstream = new igzstream(filename.c_str());
     file = intstream;
     isGood = init();
   }
 
   Reader(istream* is)
-    : filename(""), intstream(NULL), file(is), version() {
+    : filename(""), intstream(NULL), file(is), nEventsRead(0),
+      bytesReadSave(0.), timeReadSave(0.), hasIndex(false), version() {
     isGood = init();
   }
 
@@ -854,7 +856,13 @@ public:
     if (intstream) delete intstream;
     intstream = new igzstream(filename.c_str());
     file = intstream;
+    // The event index of the old file is invalid; set up a new one for
+    // the new file if the old file had one.
+    bool hadIndex = hasIndex;
+    hasIndex = false;
+    eventOffsets.clear();
     isGood = init();
+    if (isGood && hadIndex) setupIndex();
     return isGood;
   }
 
@@ -879,12 +887,42 @@ public:
    weightnames_detailed_vec.resize(0);
   }
 
+  // Skip a number of events by only looking for the event tags, without
+  // parsing them. Returns false if the end of the file is reached.
+  bool skipEvents(int nSkip);
+
+  // Set up an index of the (uncompressed) byte offsets of all events in
+  // the file, either read from the sidecar file <filename>.idx or built
+  // in a fast scan of the file, which then optionally is saved as such
+  // a sidecar file. The sidecar file is only used if the size and
+  // modification time of the file match those stored in it. Not possible
+  // for external streams.
+  bool setupIndex(bool saveIndex = true);
+
+  // Move to the start of event iEvent, counted from zero at the start of
+  // the file, using the index. Returns false if this is not possible.
+  bool seekEvent(long iEvent);
+
+  // Number of events in the index, or -1 if there is no index.
+  long nIndexed() const {
+    return (hasIndex) ? long(eventOffsets.size()) : -1; }
+
+  // Statistics on reading: number of events read, number of bytes
+  // (uncompressed) read and CPU time in seconds spent in readEvent().
+  long   nRead()     const { return nEventsRead; }
+  double bytesRead() const { return bytesReadSave; }
+  double timeRead()  const { return timeReadSave; }
+
 protected:
 
+  // Used internally by readEvent() to read and parse the event.
+  bool parseEvent(HEPEUP * peup);
+
   // Used internally to read a single line from the stream.
   bool getLine() {
     currentLine = "";
     if(!getline(*file, currentLine)) return false;
+    bytesReadSave += currentLine.size() + 1;
     // Replace single by double quotes
     replace(currentLine.begin(),currentLine.end(),'\'','\"');
     return true;
@@ -906,6 +944,14 @@ protected:
   // The last line read in from the stream in getline().
   string currentLine;
 
+  // Counters for the reading statistics.
+  long   nEventsRead;
+  double bytesReadSave, timeReadSave;
+
+  // Index of event byte offsets.
+  bool hasIndex;
+  vector<long long> eventOffsets;
+
 public:
 
   // Save if the initialisation worked.
@@ -87,9 +87,13 @@ public:
 
   // Method to be used for LHAupLHEF derived class.
   virtual void newEventFile(const char*) {}
+  virtual void setReadMode(int, int = -1) {}
   virtual bool fileFound() {return true;}
   virtual bool useExternal() {return false;}
 
+  // Print statistics at the end of the run, e.g. on reading speed.
+  virtual void stat() {}
+
   // A pure virtual method setInit, wherein all initialization information
   // is supposed to be set in the derived class. Can do this by reading a
   // file or some other way, as desired. Returns false if it did not work.
@@ -352,7 +356,8 @@ public:
     is(isIn), is_gz(NULL), isHead(isHeadIn), isHead_gz(NULL),
     readHeaders(readHeadersIn), reader(is),
     setScalesFromLHEF(setScalesFromLHEFIn), hasExtFileStream(true),
-    hasExtHeaderStream(true) {setPtr(infoPtrIn);}
+    hasExtHeaderStream(true), indexMode(0), nLast(-1), iEventNow(0) {
+    setPtr(infoPtrIn);}
 
   LHAupLHEF(Pythia8::Info* infoPtrIn, const char* filenameIn,
     const char* headerIn = NULL, bool readHeadersIn = false,
@@ -361,7 +366,7 @@ public:
     is(NULL), is_gz(NULL), isHead(NULL), isHead_gz(NULL),
     readHeaders(readHeadersIn), reader(filenameIn),
     setScalesFromLHEF(setScalesFromLHEFIn), hasExtFileStream(false),
-    hasExtHeaderStream(false) {
+    hasExtHeaderStream(false), indexMode(0), nLast(-1), iEventNow(0) {
     setPtr(infoPtrIn);
     is = (openFile(filenameIn, ifs));
     isHead = (headerfile == NULL) ? is : openFile(headerfile, ifsHead);
@@ -396,6 +401,7 @@ public:
     is_gz = new igzstream(filenameIn);
     // Re-initialise Les Houches file reader.
     reader.setup(filenameIn);
+    iEventNow = 0;
     // Set isHead to is to keep expected behaviour in
     // fileFound() and closeAllFiles().
     isHead    = is;
@@ -415,24 +421,35 @@ public:
   bool setInitLHEF( istream & isIn, bool readHead);
 
   // Routine for doing the job of reading and setting info on next event.
+  // Stop at the end of the requested range of events, if any.
   bool setEvent(int = 0) {
+    if (nLast >= 0 && iEventNow >= nLast) return false;
+    ++iEventNow;
     if (!setNewEventLHEF()) return false;
     return setOldEventLHEF();
   }
 
-  // Skip ahead a number of events, which are not considered further.
-  bool skipEvent(int nSkip) {
-    for (int iSkip = 0; iSkip < nSkip; ++iSkip)
-      if (!setNewEventLHEF()) return false;
-     return true;
+  // Set how events are skipped: 0 by reading them in full, 1 by a fast
+  // scan for the event tags, 2 by an index of event positions in the file.
+  // Optionally stop reading when event nLastIn (counted from zero) is
+  // reached, i.e. only use events before it.
+  void setReadMode(int indexModeIn, int nLastIn = -1) {
+    indexMode = indexModeIn;
+    nLast     = nLastIn;
   }
 
+  // Skip ahead a number of events, which are not considered further.
+  bool skipEvent(int nSkip);
+
   // Routine for doing the job of reading and setting info on next event.
   bool setNewEventLHEF();
 
   // Update cross-section information at the end of the run.
   bool updateSigma() {return true;}
 
+  // Print statistics on reading speed.
+  void stat();
+
 protected:
 
   // Used internally to read a single line from the stream.
@@ -473,6 +490,10 @@ private:
   // Flag to set particle production scales or not.
   bool setScalesFromLHEF, hasExtFileStream, hasExtHeaderStream;
 
+  // How to skip events, the end of the event range, and the number
+  // of events read or skipped so far.
+  int  indexMode, nLast, iEventNow;
+
 };
 
 //==========================================================================
@@ -86,6 +86,31 @@ private:
   double sigTot, sigND, sigEl, sigXB, sigAX, sigXX, sigAnn, sigEx, sigResTot;
   vector<pair<int, double>> sigRes;
 
+  // Cross sections at nominal masses, tabulated in eCM for each incoming
+  // pair and process. Bins are filled the first time they are used, and
+  // the state of each bin is 0 if unused, 1 if interpolated and 2 if
+  // it must be evaluated directly, since the midpoint check failed.
+  struct SigmaTable {
+    double mA, mB, eMin;
+    vector<double> sigma;
+    vector<bool> hasNode;
+    vector<unsigned char> binState;
+  };
+  map<pair<pair<int, int>, int>, SigmaTable> sigmaTables;
+
+  // Settings for the cross section tables.
+  bool useTables, checkTables;
+  double tableStep, tableRange, tableTolerance;
+
+  // Get cross section from table, or evaluate it directly if not possible.
+  double sigmaTab(int idAIn, int idBIn, double eCMIn, double mAIn,
+    double mBIn, int proc);
+
+  // Evaluate total or partial cross sections without tables.
+  double sigmaTotalCalc(int idA, int idB, double eCM, double mA, double mB);
+  double sigmaPartialCalc(int idA, int idB, double eCM,
+    double mA, double mB, int proc);
+
   // Set current configuration, ordering inputs hadrons in a canonical way.
   void setConfig(int idAIn, int idBIn, double eCMIn, double mAIn, double mBIn);
 
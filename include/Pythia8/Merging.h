@@ -68,6 +68,11 @@ protected:
   // Pointer to trial MergingHooks object
   MergingHooksPtr mergingHooksPtr;
 
+  // Workers of cloned Pythia instances, to perform the trial showers of
+  // CKKW-L merging concurrently. Empty unless Merging:nTrialShowerWorkers
+  // is positive.
+  vector<TrialShowerWorker> trialShowerWorkers;
+
   // Minimal value found for the merging scale in events.
   double tmsNowMin;
   static const double TMSMISMATCH;
@@ -78,6 +83,9 @@ protected:
   // Function to perform CKKW-L merging on the event.
   int mergeProcessCKKWL( Event& process);
 
+  // Function to set up the trial shower workers for the current event.
+  void prepareTrialShowerWorkers( const Event& process);
+
   // Function to perform UMEPS merging on the event.
   int mergeProcessUMEPS( Event& process);
 
@@ -177,6 +177,7 @@ public:
     enforceStrongOrderingSave(),
     orderInRapiditySave(), pickByFullPSave(), pickByPoPT2Save(),
     includeRedundantSave(), pickBySumPTSave(), allowColourShufflingSave(),
+    shareHistoryStatesSave(),
     resetHardQRenSave(), resetHardQFacSave(), unorderedScalePrescipSave(),
     unorderedASscalePrescipSave(), unorderedPDFscalePrescipSave(),
     incompleteScalePrescipSave(), ktTypeSave(), nReclusterSave(),
@@ -512,8 +513,8 @@ public:
          doPTLundMergingSave, doCutBasedMergingSave,
          includeMassiveSave, enforceStrongOrderingSave, orderInRapiditySave,
          pickByFullPSave, pickByPoPT2Save, includeRedundantSave,
-         pickBySumPTSave, allowColourShufflingSave, resetHardQRenSave,
-         resetHardQFacSave;
+         pickBySumPTSave, allowColourShufflingSave, shareHistoryStatesSave,
+         resetHardQRenSave, resetHardQFacSave;
   int    unorderedScalePrescipSave, unorderedASscalePrescipSave,
          unorderedPDFscalePrescipSave, incompleteScalePrescipSave,
          ktTypeSave, nReclusterSave, nQuarksMergeSave, nRequestedSave;
@@ -658,6 +659,8 @@ public:
   bool pickByFull() { return pickByFullPSave;}
   // Pick history probabilistically, with easier form of probabilities
   bool pickByPoPT2() { return pickByPoPT2Save;}
+  // Share clusterings of identical states between different paths
+  bool shareHistoryStates() { return shareHistoryStatesSave;}
   // Include redundant terms (e.g. PDF ratios) in the splitting probabilities
   bool includeRedundant(){ return includeRedundantSave;}
   // Pick by winner-takes-it-all, with minimum sum of scalar evolution pT
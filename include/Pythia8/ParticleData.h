@@ -178,7 +178,7 @@ public:
     mThr = oldPDE.mThr;
     for (int i = 0; i < int(oldPDE.channels.size()); ++i) {
       DecayChannel oldDC = oldPDE.channels[i]; channels.push_back(oldDC); }
-    currentBRSum = oldPDE.currentBRSum; resonancePtr = oldPDE.resonancePtr;
+    currentBRSum = oldPDE.currentBRSum; resonancePtr = 0;
     particleDataPtr = oldPDE.particleDataPtr; }
 
   // Assignment operator.
@@ -190,6 +190,9 @@ private:
   // The Colour reconnection class used to do colour reconnection.
   ColRecPtr colourReconnectionPtr{};
 
+  // Checkpoint of the event record, restored when reconnection fails.
+  Event eventSave;
+
   // The Junction splitting class used to split junctions systems.
   JunctionSplitting junctionSplitting;
 
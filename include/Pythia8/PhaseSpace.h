@@ -121,7 +121,8 @@ protected:
   // Constructor.
   PhaseSpace() : sigmaProcessPtr(), lhaUpPtr(), gammaKinPtr(),
     useBreitWigners(), doEnergySpread(), showSearch(), showViolation(),
-    increaseMaximum(), hasQ2Min(), gmZmodeGlobal(), mHatGlobalMin(),
+    increaseMaximum(), hasQ2Min(), gmZmodeGlobal(), nAdaptIter(),
+    nAdaptPoints(), mHatGlobalMin(),
     mHatGlobalMax(), pTHatGlobalMin(), pTHatGlobalMax(), Q2GlobalMin(),
     pTHatMinDiverge(), minWidthBreitWigners(), minWidthNarrowBW(), idA(),
     idB(), idAgm(), idBgm(), mA(), mB(), eCM(), s(), sigmaMxGm(),
@@ -144,10 +145,11 @@ protected:
     intY56(), mTchan1(), sTchan1(), mTchan2(), sTchan2(), frac3Flat(),
     frac3Pow1(), frac3Pow2(), zNegMin(), zNegMax(), zPosMin(), zPosMax(),
     nTau(), nY(), nZ(), tauCoef(), yCoef(), zCoef(), tauCoefSum(), yCoefSum(),
-    zCoefSum(), useBW(), useNarrowBW(), idMass(), mPeak(), sPeak(), mWidth(),
-    mMin(), mMax(), mw(), wmRat(), mLower(), mUpper(), sLower(), sUpper(),
-    fracFlatS(), fracFlatM(), fracInv(), fracInv2(), atanLower(), atanUpper(),
-    intBW(), intFlatS(), intFlatM(), intInv(), intInv2() {}
+    zCoefSum(), storeShape(), tauShape(), yShape(), zShape(), useBW(),
+    useNarrowBW(), idMass(), mPeak(), sPeak(), mWidth(), mMin(), mMax(), mw(),
+    wmRat(), mLower(), mUpper(), sLower(), sUpper(), fracFlatS(), fracFlatM(),
+    fracInv(), fracInv2(), atanLower(), atanUpper(), intBW(), intFlatS(),
+    intFlatM(), intInv(), intInv2() {}
 
   // Constants: could only be changed in the code itself.
   static const int    NMAXTRY, NTRY3BODY;
@@ -155,7 +157,7 @@ protected:
                       WIDTHMARGIN, SAMEMASS, MASSMARGIN, EXTRABWWTMAX,
                       THRESHOLDSIZE, THRESHOLDSTEP, YRANGEMARGIN, LEPTONXMIN,
                       LEPTONXMAX, LEPTONXLOGMIN, LEPTONXLOGMAX, LEPTONTAUMIN,
-                      SHATMINZ, PT2RATMINZ, WTCORRECTION[11];
+                      SHATMINZ, PT2RATMINZ, ADAPTEVENFRAC, WTCORRECTION[11];
 
   // Pointer to cross section.
   SigmaProcess* sigmaProcessPtr;
@@ -169,7 +171,7 @@ protected:
   // Initialization data, normally only set once.
   bool   useBreitWigners, doEnergySpread, showSearch, showViolation,
          increaseMaximum, hasQ2Min;
-  int    gmZmodeGlobal;
+  int    gmZmodeGlobal, nAdaptIter, nAdaptPoints;
   double mHatGlobalMin, mHatGlobalMax, pTHatGlobalMin, pTHatGlobalMax,
          Q2GlobalMin, pTHatMinDiverge, minWidthBreitWigners, minWidthNarrowBW;
 
@@ -205,6 +207,11 @@ protected:
   void setup3Body();
   bool setupSampling123(bool is2, bool is3);
 
+  // Adapt the coefficients to sampled cross sections in 2 -> 1/2/3.
+  double adaptSampling123(bool is2, bool is3);
+  void adaptCoef( int n, double var[8], double coef[8]);
+  void sumCoef123();
+
   // Select a trial kinematics phase space point.
   bool trialKin123(bool is2, bool is3, bool inEvent = true);
 
@@ -228,6 +235,10 @@ protected:
   double tauCoef[8], yCoef[8], zCoef[8], tauCoefSum[8], yCoefSum[8],
          zCoefSum[8];
 
+  // Value of each shape, without coefficient, when adapting the latter.
+  bool   storeShape;
+  double tauShape[8], yShape[8], zShape[8];
+
   // Calculate kinematical limits for 2 -> 1/2/3.
   bool limitTau(bool is2, bool is3);
   bool limitY();
@@ -148,11 +148,13 @@ public:
 
   // Possibility to pass in pointer for full merging class.
   bool setMergingPtr( MergingPtr mergingPtrIn)
-    { mergingPtr = mergingPtrIn; return true;}
+    { mergingPtr = mergingPtrIn; hasUserMerging = bool(mergingPtrIn);
+      return true;}
 
   // Possibility to pass in pointer for merging hooks.
   bool setMergingHooksPtr( MergingHooksPtr mergingHooksPtrIn)
-    { mergingHooksPtr = mergingHooksPtrIn; return true;}
+    { mergingHooksPtr = mergingHooksPtrIn;
+      hasUserMergingHooks = bool(mergingHooksPtrIn); return true;}
 
   // Possibility to pass in pointer for beam shape.
   bool setBeamShapePtr( BeamShapePtr beamShapePtrIn)
@@ -170,7 +172,8 @@ public:
 
   // Possibility to pass in pointer for external showers.
   bool setShowerModelPtr( ShowerModelPtr showerModelPtrIn)
-    { showerModelPtr = showerModelPtrIn; return true;}
+    { showerModelPtr = showerModelPtrIn;
+      hasUserShowerModel = bool(showerModelPtrIn); return true;}
 
   // Possibility to pass in pointer for modelling of heavy ion collisions.
   bool setHeavyIonsPtr( HeavyIonsPtr heavyIonsPtrIn)
@@ -473,9 +476,20 @@ private:
   // The main generator class to produce the parton level of the event.
   PartonLevel partonLevel = {};
 
+  // Checkpoint of the process record, restored when parton level fails.
+  Event processSave = {};
+
   // The main generator class to perform trial showers of the event.
   PartonLevel trialPartonLevel = {};
 
+  // Cloned generators to perform trial showers of the event concurrently.
+  vector< shared_ptr<Pythia> > trialShowerWorkers = {};
+
+  // Flags for objects supplied by the user rather than set up by init,
+  // which then cannot be cloned for the trial shower workers.
+  bool hasUserMerging = {}, hasUserMergingHooks = {},
+       hasUserShowerModel = {}, hasUserPDFs = {};
+
   // Flags for defining the merging scheme.
   bool        doMerging = {};
 
@@ -521,6 +535,9 @@ private:
   // Set up pointers to PDFs.
   bool initPDFs();
 
+  // Set up cloned generators to perform trial showers for merging.
+  bool initTrialShowerWorkers(int nWorkers);
+
   // Recalculate kinematics for each event when beam momentum has a spread.
   void nextKinematics();
 
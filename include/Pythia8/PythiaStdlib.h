@@ -29,6 +29,11 @@
 #include <list>
 #include <functional>
 
+// Stdlib header files for threads and thread safety.
+#include <thread>
+#include <mutex>
+#include <atomic>
+
 // Stdlib header file for dynamic library loading.
 #include <dlfcn.h>
 
@@ -121,6 +126,12 @@ using std::weak_ptr;
 using std::dynamic_pointer_cast;
 using std::make_shared;
 
+// Threads and thread safety.
+using std::thread;
+using std::mutex;
+using std::lock_guard;
+using std::atomic;
+
 } // end namespace Pythia8
 
 namespace Pythia8 {
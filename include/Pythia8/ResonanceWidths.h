@@ -82,11 +82,11 @@ protected:
     idInFlav(), widNow(), mHat(), mf1(), mf2(), mf3(), mr1(), mr2(), mr3(),
     ps(), kinFac(), alpEM(), alpS(), colQ(), preFac(), particlePtr(),
     infoPtr(), settingsPtr(), particleDataPtr(), coupSMPtr(),
-    coupSUSYPtr(){}
+    coupSUSYPtr(), doTabulate(), checkTabulate(), tolTabulate() {}
 
   // Constants: could only be changed in the code itself.
-  static const int    NPOINT;
-  static const double MASSMIN, MASSMARGIN;
+  static const int    NPOINT, NTABINIT, NTABDEPTH, NTABMAX;
+  static const double MASSMIN, MASSMARGIN, TABNGAMMA, TABSAFETY;
 
   // Particle properties always present.
   int    idRes, hasAntiRes;
@@ -138,6 +138,47 @@ protected:
   double numInt2BW(double mHatIn, double m1, double Gamma1, double mMin1,
     double m2, double Gamma2, double mMin2, int psMode = 1);
 
+private:
+
+  // Table of total and partial widths as a function of mass, for a given
+  // charge sign, incoming flavour and open-only choice. For each node the
+  // total width is followed by the partial widths. Intervals flagged exact
+  // are instead evaluated directly.
+  struct WidthTable {
+    WidthTable() : nChan() {}
+    int            nChan;
+    vector<double> mNode, widNode;
+    vector<bool>   isExact;
+  };
+
+  // Tabulation of widths: switches, tolerance and tables built so far.
+  bool   doTabulate, checkTabulate;
+  double tolTabulate;
+  map<int, WidthTable> widthTables;
+
+  // Calculate the total/open width by a loop over all channels.
+  // Optionally also return the partial widths of each channel.
+  double widthCalc(int idSgn, double mHatIn, int idInFlavIn, bool openOnly,
+    bool setBR, int idOutFlav1, int idOutFlav2,
+    vector<double>* widChanPtr = nullptr);
+
+  // Interpolate in table of widths, if possible. Build table when needed.
+  bool widthTabulated(int idSgn, double mHatIn, int idInFlavIn,
+    bool openOnly, bool setBR, double& widSum,
+    vector<double>* widChanPtr = nullptr);
+
+  // Build a table of widths, and recursively refine an interval of it.
+  void buildWidthTable(WidthTable& table, int idSgn, int idInFlavIn,
+    bool openOnly);
+  void refineWidthTable(WidthTable& table, int idSgn, int idInFlavIn,
+    bool openOnly, double mLow, const vector<double>& widLow, double mMid,
+    const vector<double>& widMid, double mHigh,
+    const vector<double>& widHigh, int depth);
+
+  // Total width followed by partial widths, for a node of a table.
+  void widthNode(int idSgn, double mHatIn, int idInFlavIn, bool openOnly,
+    vector<double>& widVal);
+
 };
 
 //==========================================================================
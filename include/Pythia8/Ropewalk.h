@@ -217,7 +217,7 @@ public:
     shoveJunctionStrings(),
     shoveMiniStrings(), shoveGluonLoops(), mStringMin(), limitMom(), rCutOff(),
     gAmplitude(), gExponent(), deltay(), deltat(), tShove(), tInit(),
-    showerCut(), alwaysHighest() {}
+    showerCut(), alwaysHighest(), useNeighbourList(), rSkin() {}
 
   // The Ropewalk init function sets parameters and pointers.
   virtual bool init();
@@ -278,6 +278,9 @@ private:
   double showerCut;
   // Assume we are always in highest multiplet.
   bool alwaysHighest;
+  // Only shove nearby string pieces, using neighbour lists with a skin.
+  bool useNeighbourList;
+  double rSkin;
 
   // All dipoles in the event sorted by event record.
   // Index of the two partons.
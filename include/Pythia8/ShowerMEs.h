@@ -49,6 +49,11 @@ public:
   (vector<int> idIn, vector<int> idOut, set<int> sChan) = 0;
   // Get the matrix element squared for a particle state.
   virtual double me2Vincia(vector<Particle> state, int nIn) = 0;
+  // Get the matrix elements squared for several particle states, e.g.
+  // several phase-space points of the same process. By default the
+  // states are evaluated one by one.
+  virtual void me2VinciaBatch(const vector< vector<Particle> >& states,
+    int nIn, vector<double>& me2s);
   // Use me2 to set helicities for a state. Takes a reference as
   // input and operates on it.
   virtual bool selectHelicitiesVincia(vector<Particle>& state, int nIn,
@@ -131,6 +136,11 @@ public:
   // Get the matrix element squared for a particle state.
   double me2Vincia(vector<Particle> state, int nIn) override {
     return mesPtr != nullptr ? mesPtr->me2Vincia(state, nIn) : -1;}
+  // Get the matrix elements squared for several particle states.
+  void me2VinciaBatch(const vector< vector<Particle> >& states, int nIn,
+    vector<double>& me2s) override {
+    if (mesPtr != nullptr) mesPtr->me2VinciaBatch(states, nIn, me2s);
+    else me2s.assign(states.size(), -1);}
   // Check if the process is available.
   bool hasProcessVincia(vector<int> idIn, vector<int> idOut,
     set<int> sChan) override {return mesPtr != nullptr ?
@@ -20,6 +20,9 @@
 #include <fstream>
 #include <string.h>
 #ifdef GZIP
+#include <cstdio>
+#include <string>
+#include <vector>
 #include <zlib.h>
 #endif
 
@@ -35,15 +38,48 @@ namespace Pythia8 {
 
 class gzstreambuf : public std::streambuf {
 private:
-    static const int bufferSize = 47+256;    // size of data buff
-    // totals 512 bytes under g++ for igzstream at the end.
+    static const int bufferSize = 4+65536;   // size of data buff
+    // 4 bytes putback area, and blocks of 64 kB for each gzread call.
 
     gzFile           file{};               // file handle for compressed file
     char             buffer[bufferSize]{}; // data buffer
     char             opened{};             // open/close state of stream
     int              mode{};               // I/O mode
+    std::string      fileName{};           // name of the opened file
+
+    // An access point in a compressed file, where decompression can be
+    // restarted: the uncompressed and compressed byte positions, the
+    // number of bits of the compressed byte before it that are still to
+    // be used, and the 32 kB of uncompressed data just before it.
+    struct AccessPoint {
+        long long out, in;
+        int bits;
+        std::vector<unsigned char> window;
+    };
+    static const int windowSize = 32768;
+    static const int inSize     = 16384;
+
+    // Own decompression of the file, instead of via gzread, used when
+    // access points are recorded or after a jump to an access point.
+    bool             useInflate{};         // read with own decompression
+    bool             hasStrm{};            // inflate stream initialized
+    bool             isRaw{};              // gzip header already passed
+    bool             recording{};          // recording access points
+    FILE*            rawFile{};            // file handle for raw input
+    z_stream         strm{};               // inflate stream state
+    unsigned char    inBuf[inSize]{};      // compressed input buffer
+    int              nTrailer{};           // gzip trailer bytes to skip
+    long long        totIn{}, totOut{};    // bytes read and decompressed
+    long long        span{}, lastPoint{};  // distance between points
+    std::vector<unsigned char> ring{};     // last uncompressed 32 kB
+    std::vector<AccessPoint> points{};     // recorded access points
 
     int flush_buffer();
+    int inflate_buffer( char* out, int len);
+    bool start_inflate( const AccessPoint* point);
+    void end_inflate();
+    void add_point();
+    long long file_size();
 public:
     gzstreambuf() : opened(0) {
         setp( buffer, buffer + (bufferSize-1));
@@ -60,6 +96,29 @@ public:
     virtual int     overflow( int c = EOF);
     virtual int     underflow();
     virtual int     sync();
+
+    // Positioning in the uncompressed data, for input only. Seeking is
+    // fast in uncompressed files, but decompresses up to the position
+    // in compressed ones, unless access points are available, see below.
+    virtual std::streampos seekoff( std::streamoff off,
+        std::ios_base::seekdir dir,
+        std::ios_base::openmode which = std::ios_base::in);
+    virtual std::streampos seekpos( std::streampos pos,
+        std::ios_base::openmode which = std::ios_base::in);
+
+    // Access points make seeking fast also in compressed files, since
+    // decompression then only starts from the closest point before the
+    // position. They are recorded while the file is read through from
+    // the start, after calling record_access_points on a newly opened
+    // file, and can be copied to another stream of the same file or saved
+    // to and restored from a binary file. Nothing is done for files that
+    // are not compressed, where seeking is fast anyway.
+    bool record_access_points( long long spanIn = 16777216);
+    int  n_access_points() const { return int(points.size()); }
+    void copy_access_points( const gzstreambuf& other) {
+        points = other.points; }
+    bool write_access_points( const char* name);
+    bool read_access_points( const char* name);
 };
 
 // -------------------------------------------------------------------------
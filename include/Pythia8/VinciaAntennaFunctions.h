@@ -81,8 +81,9 @@ public:
   virtual int id1() const = 0;
 
   // The antenna function [GeV^-2].
-  virtual double antFun(vector<double> invariants, vector<double> mNew,
-    vector<int> helBef, vector<int> helNew) = 0;
+  virtual double antFun(const vector<double>& invariants,
+    const vector<double>& mNew, const vector<int>& helBef,
+    const vector<int>& helNew) = 0;
 
   // Optional implementation of the DGLAP kernels for collinear-limit checks
   // Defined as PI/sij + PK/sjk, i.e. equivalent to antennae.
@@ -103,20 +104,22 @@ public:
   virtual bool check();
 
   // Method to intialise mass values.
-  virtual void initMasses(vector<double>* masses) {
+  virtual void initMasses(const vector<double>* masses) {
     if (masses->size() >= 3) {
       mi = masses->at(0); mj = masses->at(1); mk = masses->at(2);
     } else {mi = 0.0; mj = 0.0; mk = 0.0;}}
 
   // Method to initialise internal helicity variables.
-  virtual int initHel(vector<int>* helBef, vector<int>* helNew);
+  virtual int initHel(const vector<int>* helBef,
+    const vector<int>* helNew);
 
   // Wrapper for helicity-summed/averaged antenna function.
-  double antFun(vector<double> invariants, vector<double> masses) {
+  double antFun(const vector<double>& invariants,
+    const vector<double>& masses) {
     return antFun(invariants, masses, hDum, hDum);}
 
   // Wrapper for massless, helicity-summed/averaged antenna function.
-  double antFun(vector<double> invariants) {
+  double antFun(const vector<double>& invariants) {
     return antFun(invariants, mDum, hDum, hDum);}
 
   // Wrapper without helicity assignments.
@@ -195,6 +198,16 @@ protected:
   vector<double> mDum{0, 0, 0, 0};
   vector<int> hDum{9, 9, 9, 9};
 
+  // Work vectors for antennae that swap, pad or symmetrise their
+  // arguments, reused between calls to avoid allocations.
+  vector<double> invSwap, mSwap, invSym;
+  vector<int>    hBefSwap, hNewSwap, hBefPad, hNewPad, hSym;
+
+  // Helicities padded with n unpolarised entries if fewer than n.
+  const vector<int>& padHel(const vector<int>& hel, vector<int>& hPad,
+    unsigned int n) { if (hel.size() >= n) return hel;
+    hPad = hel; hPad.insert(hPad.end(), n, 9); return hPad;}
+
 };
 
 //==========================================================================
@@ -214,8 +227,9 @@ public:
   virtual int id1() const {return 21;}
 
   // The antenna function [GeV^-2].
-  virtual double antFun(vector<double> invariants, vector<double> mNew,
-    vector<int> helBef, vector<int> helNew);
+  virtual double antFun(const vector<double>& invariants,
+    const vector<double>& mNew, const vector<int>& helBef,
+    const vector<int>& helNew);
 
   // Function to give Altarelli-Parisi limits of this antenna.
   // Defined as PI/sij + PK/sjk, i.e. equivalent to antennae.
@@ -241,8 +255,9 @@ public:
   virtual int id1() const {return 21;}
 
   // The antenna function [GeV^-2].
-  virtual double antFun(vector<double> invariants,
-    vector<double> mNew, vector<int> helBef, vector<int> helNew);
+  virtual double antFun(const vector<double>& invariants,
+    const vector<double>& mNew, const vector<int>& helBef,
+    const vector<int>& helNew);
 
   // Function to give Altarelli-Parisi limits of this antenna.
   virtual double AltarelliParisi(vector<double> invariants,
@@ -267,8 +282,9 @@ public:
   virtual int id1() const {return 21;}
 
   // The antenna function [GeV^-2] (derived from AntQGemit by swapping).
-  virtual double antFun(vector<double> invariants,
-    vector<double> mNew, vector<int> helBef, vector<int> helNew);
+  virtual double antFun(const vector<double>& invariants,
+    const vector<double>& mNew, const vector<int>& helBef,
+    const vector<int>& helNew);
 
   // Function to give Altarelli-Parisi limits of this antenna.
   virtual double AltarelliParisi(vector<double> invariants,
@@ -293,8 +309,9 @@ public:
   virtual int id1()    const {return 21;}
 
   // The antenna function [GeV^-2].
-  virtual double antFun(vector<double> invariants,
-    vector<double> mNew, vector<int> helBef, vector<int> helNew);
+  virtual double antFun(const vector<double>& invariants,
+    const vector<double>& mNew, const vector<int>& helBef,
+    const vector<int>& helNew);
 
   // Function to give Altarelli-Parisi limits of this antenna.
   virtual double AltarelliParisi(vector<double> invariants,
@@ -319,8 +336,9 @@ public:
   virtual int id1() const {return -1;}
 
   // The antenna function [GeV^-2].
-  virtual double antFun(vector<double> invariants,
-    vector<double> mNew, vector<int> helBef, vector<int> helNew);
+  virtual double antFun(const vector<double>& invariants,
+    const vector<double>& mNew, const vector<int>& helBef,
+    const vector<int>& helNew);
 
   // Function to give Altarelli-Parisi limits of this antenna.
   virtual double AltarelliParisi(vector<double> invariants,
@@ -345,8 +363,9 @@ class AntQGemitFFsec : public AntQGemitFF {
 public:
 
   // The antenna function [GeV^-2].
-  virtual double antFun(vector<double> invariants,
-    vector<double> mNew, vector<int> helBef, vector<int> helNew);
+  virtual double antFun(const vector<double>& invariants,
+    const vector<double>& mNew, const vector<int>& helBef,
+    const vector<int>& helNew);
 
 };
 
@@ -365,8 +384,9 @@ public:
   virtual int id1() const {return 21;}
 
   // The antenna function [GeV^-2] (derived from AntQGemitFFsec by swapping).
-  virtual double antFun(vector<double> invariants,
-    vector<double> mNew, vector<int> helBef, vector<int> helNew);
+  virtual double antFun(const vector<double>& invariants,
+    const vector<double>& mNew, const vector<int>& helBef,
+    const vector<int>& helNew);
 
   // Function to give Altarelli-Parisi limits of this antenna.
   virtual double AltarelliParisi(vector<double> invariants,
@@ -384,8 +404,9 @@ class AntGGemitFFsec : public AntGGemitFF {
 public:
 
   // The dimensionless antenna function.
-  virtual double antFun(vector<double> invariants, vector<double> mNew,
-    vector<int> helBef, vector<int> helNew);
+  virtual double antFun(const vector<double>& invariants,
+    const vector<double>& mNew, const vector<int>& helBef,
+    const vector<int>& helNew);
 
 };
 
@@ -399,8 +420,9 @@ class AntGXsplitFFsec : public AntGXsplitFF {
  public:
 
   // The antenna function [GeV^-2].
-  virtual double antFun(vector<double> invariants, vector<double> mNew,
-    vector<int> helBef, vector<int> helNew);
+  virtual double antFun(const vector<double>& invariants,
+    const vector<double>& mNew, const vector<int>& helBef,
+    const vector<int>& helNew);
 
 };
 
@@ -463,8 +485,9 @@ public:
   virtual int id2() const override {return -1;}
 
   // The antenna function [GeV^-2].
-  virtual double antFun(vector<double> invariants, vector<double> masses,
-    vector<int> helBef, vector<int> helNew) override;
+  virtual double antFun(const vector<double>& invariants,
+    const vector<double>& masses, const vector<int>& helBef,
+    const vector<int>& helNew) override;
 
   // AP splitting kernel for collinear limit checks.
   virtual double AltarelliParisi(vector<double> invariants,
@@ -491,8 +514,9 @@ public:
   virtual int id2() const override {return 1;}
 
   // The antenna function.
-  virtual double antFun(vector<double> invariants, vector<double> masses,
-    vector<int> helBef, vector<int> helNew) override;
+  virtual double antFun(const vector<double>& invariants,
+    const vector<double>& masses, const vector<int>& helBef,
+    const vector<int>& helNew) override;
 
   // AP splitting kernel for collinear limit checks.
   virtual double AltarelliParisi(vector<double> invariants,
@@ -519,8 +543,9 @@ public:
   virtual int id2() const override {return 21;}
 
   // The antenna function [GeV^-2].
-  virtual double antFun(vector<double> invariants, vector<double> masses,
-    vector<int> helBef, vector<int> helNew) override;
+  virtual double antFun(const vector<double>& invariants,
+    const vector<double>& masses, const vector<int>& helBef,
+    const vector<int>& helNew) override;
 
   // AP splitting kernel, P(z)/Q2.
   virtual double AltarelliParisi(vector<double> invariants,
@@ -549,8 +574,9 @@ public:
   virtual int id2() const override {return 0;}
 
   // The antenna function [GeV^-2].
-  virtual double antFun(vector<double> invariants, vector<double> masses,
-    vector<int> helBef, vector<int> helNew) override;
+  virtual double antFun(const vector<double>& invariants,
+    const vector<double>& masses, const vector<int>& helBef,
+    const vector<int>& helNew) override;
 
   // AP splitting kernel, P(z)/Q2.
   virtual double AltarelliParisi(vector<double> invariants,
@@ -581,8 +607,9 @@ public:
   virtual int id2() const override {return 0;}
 
   // The antenna function [GeV^-2].
-  virtual double antFun(vector<double> invariants, vector<double> masses,
-    vector<int> helBef, vector<int> helNew) override;
+  virtual double antFun(const vector<double>& invariants,
+    const vector<double>& masses, const vector<int>& helBef,
+    const vector<int>& helNew) override;
 
   // AP splitting kernel, P(z)/Q2.
   virtual double AltarelliParisi(vector<double> invariants,
@@ -686,8 +713,9 @@ public:
   virtual int id2() const override {return -1;}
 
   // The antenna function [GeV^-2].
-  virtual double antFun(vector<double> invariants, vector<double> masses,
-    vector<int> helBef, vector<int> helNew) override;
+  virtual double antFun(const vector<double>& invariants,
+    const vector<double>& masses, const vector<int>& helBef,
+    const vector<int>& helNew) override;
 
   // The AP kernel, P(z)/Q2.
   virtual double AltarelliParisi(vector<double> invariants,
@@ -720,8 +748,9 @@ public:
   virtual int id2() const override {return 21;}
 
   // The antenna function [GeV^-2].
-  virtual double antFun(vector<double> invariants, vector<double> masses,
-    vector<int> helBef, vector<int> helNew) override;
+  virtual double antFun(const vector<double>& invariants,
+    const vector<double>& masses, const vector<int>& helBef,
+    const vector<int>& helNew) override;
 
   // The AP kernel, P(z)/Q2.
   virtual double AltarelliParisi(vector<double> invariants,
@@ -748,8 +777,9 @@ public:
   virtual int id2() const override {return 1;}
 
   // The antenna function [GeV^-2].
-  virtual double antFun(vector<double> invariants, vector<double> masses,
-    vector<int> helBef, vector<int> helNew) override;
+  virtual double antFun(const vector<double>& invariants,
+    const vector<double>& masses, const vector<int>& helBef,
+    const vector<int>& helNew) override;
 
   // The AP kernel, P(z)/Q2.
   virtual double AltarelliParisi(vector<double> invariants,
@@ -776,8 +806,9 @@ public:
   virtual int id2() const override {return 21;}
 
   // The antenna function [GeV^-2].
-  virtual double antFun(vector<double> invariants, vector<double> masses,
-    vector<int> helBef, vector<int> helNew) override;
+  virtual double antFun(const vector<double>& invariants,
+    const vector<double>& masses, const vector<int>& helBef,
+    const vector<int>& helNew) override;
 
   // The AP kernel, P(z)/Q2.
   virtual double AltarelliParisi(vector<double> invariants,
@@ -806,8 +837,9 @@ public:
   virtual int id2() const override {return 0;}
 
   // The antenna function [GeV^-2].
-  virtual double antFun(vector<double> invariants, vector<double> masses,
-    vector<int> helBef, vector<int> helNew) override;
+  virtual double antFun(const vector<double>& invariants,
+    const vector<double>& masses, const vector<int>& helBef,
+    const vector<int>& helNew) override;
 
   virtual double AltarelliParisi(vector<double> invariants,
     vector<double> /*mNew*/, vector<int> helBef, vector<int> helNew) override;
@@ -837,8 +869,9 @@ public:
   virtual int id2() const override {return 0;}
 
   // The antenna function [GeV^-2].
-  virtual double antFun(vector<double> invariants, vector<double> masses,
-    vector<int> helBef, vector<int> helNew) override;
+  virtual double antFun(const vector<double>& invariants,
+    const vector<double>& masses, const vector<int>& helBef,
+    const vector<int>& helNew) override;
 
   // The AP kernel, P(z)/Q2.
   virtual double AltarelliParisi(vector<double> invariants,
@@ -869,8 +902,9 @@ public:
   virtual int id2() const override {return 1;}
 
   // The antenna function [GeV^-2].
-  virtual double antFun(vector<double> invariants, vector<double> masses,
-    vector<int> helBef, vector<int> helNew) override;
+  virtual double antFun(const vector<double>& invariants,
+    const vector<double>& masses, const vector<int>& helBef,
+    const vector<int>& helNew) override;
 
   // The AP kernel, P(z)/Q2.
   virtual double AltarelliParisi(vector<double> invariants,
@@ -894,8 +928,9 @@ class AntQGemitIFsec : public AntQGemitIF {
 public:
 
   // The antenna function [GeV^-2].
-  virtual double antFun(vector<double> invariants,
-    vector<double> mNew, vector<int> helBef, vector<int> helNew) override;
+  virtual double antFun(const vector<double>& invariants,
+    const vector<double>& mNew, const vector<int>& helBef,
+    const vector<int>& helNew) override;
 
 };
 
@@ -908,8 +943,9 @@ class AntGGemitIFsec : public AntGGemitIF {
 public:
 
   // The antenna function [GeV^-2].
-  virtual double antFun(vector<double> invariants,
-    vector<double> mNew, vector<int> helBef, vector<int> helNew) override;
+  virtual double antFun(const vector<double>& invariants,
+    const vector<double>& mNew, const vector<int>& helBef,
+    const vector<int>& helNew) override;
 
 };
 
@@ -923,8 +959,9 @@ class AntXGsplitIFsec : public AntXGsplitIF {
 public:
 
   // The antenna function, just 2*global [GeV^-2].
-  virtual double antFun(vector<double> invariants, vector<double> mNew,
-    vector<int> helBef, vector<int> helNew) override;
+  virtual double antFun(const vector<double>& invariants,
+    const vector<double>& mNew, const vector<int>& helBef,
+    const vector<int>& helNew) override;
 
 };
 
@@ -1304,9 +1341,15 @@ public:
   bool meAvailable(int iSys, const Event& event);
   bool meAvailable(const vector<Particle>& state);
 
-  // Get squared matrix element.
+  // Get squared matrix element. Values are cached for the current
+  // event, so that identical states are only evaluated once.
   double getME2(const vector<Particle>& state, int nIn);
   double getME2(int iSys, const Event& event);
+  // Get squared matrix elements for several states in one call.
+  void getME2(const vector< vector<Particle> >& states, int nIn,
+    vector<double>& me2s);
+  // Forget the matrix elements cached in the current event.
+  void clearME2Cache() {me2Cache.clear();}
 
   // Get matrix element correction factor for sector shower.
   double getMECSector(int iSys, const vector<Particle>& stateNow,
@@ -1352,6 +1395,10 @@ private:
   // Get colour weight.
   double getColWeight(const vector<Particle>& state);
 
+  // Make the key of a state in the matrix-element cache.
+  void makeME2Key(const vector<Particle>& state, int nIn,
+    vector<double>& key);
+
   // Verbosity level.
   int verbose;
 
@@ -1399,6 +1446,16 @@ private:
   map<int,double> me2post;
   map<int,bool>   hasME2post;
 
+  // Cache of the matrix elements evaluated in the current event, keyed
+  // by the number of incoming partons, the colour depth, and the
+  // flavour, helicity, colours and momentum of each particle.
+  static const unsigned int NME2CACHEMAX;
+  map<vector<double>, double> me2Cache;
+  // Work vectors for the cache lookup and batched evaluation.
+  vector<double> me2Key, me2Vals;
+  vector< vector<Particle> > me2States;
+  vector<int> iME2Miss;
+
 };
 
 //==========================================================================
@@ -626,10 +626,10 @@ public:
     double mK2, double mj2, double mk2);
 
   // Resonance decay kinematic maps.
-  bool map2toNRF(vector<Vec4>& pAfter, vector<Vec4> pBefore,
+  bool map2toNRF(vector<Vec4>& pAfter, const vector<Vec4>& pBefore,
     unsigned int posR, unsigned int posF,
-    vector<double> invariants,double phi,
-    vector<double> masses);
+    const vector<double>& invariants,double phi,
+    const vector<double>& masses);
 
   // 1->2 decay map for (already offshell) resonance decay
   bool map1to2RF(vector<Vec4>& pNew, Vec4 pRes, double m1,
@@ -660,6 +660,10 @@ public:
   vector<Particle> makeParticleList(const int iSys, const Event& event,
     const vector<Particle> &pNew = vector<Particle>(),
     const vector<int> &iOld = vector<int>());
+  // Same, but filling a given list, to reuse its storage.
+  void makeParticleList(vector<Particle>& state, const int iSys,
+    const Event& event, const vector<Particle> &pNew = vector<Particle>(),
+    const vector<int> &iOld = vector<int>());
 
   // Method to find all antennae that can produce a branching.
   //   IN: indices of clustering in event, where i2 is the emission.
@@ -722,9 +726,9 @@ private:
   bool map2to3IImassless(vector<Vec4>& pNew, vector<Vec4>& pRec,
     vector<Vec4>& pOld, double sAB, double saj, double sjb, double sab,
     double phi);
-  bool map2to3RF(vector<Vec4>& pThree, vector<Vec4> pTwo,
-    vector<double> invariants,double phi,
-    vector<double> masses);
+  bool map2to3RF(vector<Vec4>& pThree, const vector<Vec4>& pTwo,
+    const vector<double>& invariants,double phi,
+    const vector<double>& masses);
 
   // Members.
 
@@ -87,32 +87,32 @@ vector<int> iIn) : sectorShower(sectorShowerIn) {
   int i1() const {return (iSav.size() >= 2) ? iSav[1] : -1;}
   int i2() const {return (iSav.size() >= 3) ? iSav[2] : -1;}
   int iVec(unsigned int i) const {return (iSav.size() > i) ? iSav[i] : -1;}
-  vector<int> iVec() {return iSav;}
+  const vector<int>& iVec() const {return iSav;}
   int id0() const {return (idSav.size() >= 1) ? idSav[0] : -1;}
   int id1() const {return (idSav.size() >= 2) ? idSav[1] : -1;}
   int id2() const {return (idSav.size() >= 3) ? idSav[2] : -1;}
-  vector<int> idVec() const {return idSav;}
+  const vector<int>& idVec() const {return idSav;}
   int colType0() const {return (colTypeSav.size() >= 1) ? colTypeSav[0] : -1;}
   int colType1() const {return (colTypeSav.size() >= 2) ? colTypeSav[1] : -1;}
   int colType2() const {return (colTypeSav.size() >= 3) ? colTypeSav[2] : -1;}
-  vector<int> colTypeVec() const {return colTypeSav;}
+  const vector<int>& colTypeVec() const {return colTypeSav;}
   int col0() const {return (colSav.size() >= 1) ? colSav[0] : 0;}
   int col1() const {return (colSav.size() >= 2) ? colSav[1] : 0;}
   int col2() const {return (colSav.size() >= 3) ? colSav[2] : 0;}
-  vector<int> colVec() const {return colSav;}
+  const vector<int>& colVec() const {return colSav;}
   int acol0() const {return (acolSav.size() >= 1) ? acolSav[0] : 0;}
   int acol1() const {return (acolSav.size() >= 2) ? acolSav[1] : 0;}
   int acol2() const {return (acolSav.size() >= 3) ? acolSav[2] : 0;}
-  vector<int> acolVec() const {return acolSav;}
+  const vector<int>& acolVec() const {return acolSav;}
   int h0() const {return (hSav.size() >= 1) ? hSav[0] : -1;}
   int h1() const {return (hSav.size() >= 2) ? hSav[1] : -1;}
   int h2() const {return (hSav.size() >= 3) ? hSav[2] : -1;}
-  vector<int> hVec() const {return hSav;}
+  const vector<int>& hVec() const {return hSav;}
   double m0() const {return (mSav.size() >= 1) ? mSav[0] : -1;}
   double m1() const {return (mSav.size() >= 2) ? mSav[1] : -1;}
   double m2() const {return (mSav.size() >= 3) ? mSav[2] : -1;}
-  vector<double> mVec() const {return mSav;}
-  vector<double> getmPostVec() {return mPostSav;}
+  const vector<double>& mVec() const {return mSav;}
+  const vector<double>& getmPostVec() const {return mPostSav;}
   int colTag() {return colTagSav;}
 
   // Method to get maximum value of evolution scale for this brancher.
@@ -157,8 +157,8 @@ vector<int> iIn) : sectorShower(sectorShowerIn) {
   virtual double mNew() const {return 0.0;}
 
   // Return new particles, must be implemented by derived class.
-  virtual bool getNewParticles(Event& event, vector<Vec4> momIn,
-    vector<int> hIn, vector<Particle> &pNew,Rndm* rndmPtr,
+  virtual bool getNewParticles(Event& event, const vector<Vec4>& momIn,
+    const vector<int>& hIn, vector<Particle> &pNew,Rndm* rndmPtr,
     VinciaColour* colourPtr) = 0;
 
   // Simple print utility, showing the contents of the Brancher. Base
@@ -192,7 +192,7 @@ vector<int> iIn) : sectorShower(sectorShowerIn) {
   // Check if swapped.
   bool isSwapped() {return swapped;}
   // Return the saved invariants.
-  vector<double> getInvariants() {return invariantsSav;}
+  const vector<double>& getInvariants() const {return invariantsSav;}
 
   // This method allows to reset enhanceFac if we do an accept/reject.
   void resetEnhanceFac(const double enhanceIn) {enhanceSav = enhanceIn;}
@@ -311,8 +311,8 @@ public:
   virtual double mNew() const {return 0.0;}
 
   // Generic getter method. Assumes setter methods called earlier.
-  virtual bool getNewParticles(Event& event, vector<Vec4> momIn,
-    vector<int> hIn, vector<Particle> &pNew, Rndm* rndmPtr,
+  virtual bool getNewParticles(Event& event, const vector<Vec4>& momIn,
+    const vector<int>& hIn, vector<Particle> &pNew, Rndm* rndmPtr,
     VinciaColour* colourPtr);
 
 private:
@@ -384,8 +384,8 @@ public:
   virtual void setMaps(int sizeOld);
 
   // Generic getter method. Assumes setter methods called earlier.
-  virtual bool getNewParticles(Event& event, vector<Vec4> momIn,
-    vector<int> hIn, vector<Particle> &pNew, Rndm*, VinciaColour*);
+  virtual bool getNewParticles(Event& event, const vector<Vec4>& momIn,
+    const vector<int>& hIn, vector<Particle> &pNew, Rndm*, VinciaColour*);
 
  private:
 
@@ -501,8 +501,9 @@ public:
   void setStatPost() override;
 
   // Generic method, assumes setter methods called earlier.
-  bool getNewParticles(Event& event, vector<Vec4> momIn, vector<int> hIn,
-    vector<Particle> &pNew, Rndm* rndmPtr, VinciaColour*) override;
+  bool getNewParticles(Event& event, const vector<Vec4>& momIn,
+    const vector<int>& hIn, vector<Particle> &pNew, Rndm* rndmPtr,
+    VinciaColour*) override;
 
   // Generate a new Q2 scale.
   double genQ2(int evTypeIn, double Q2MaxNow, Rndm* rndmPtr,
@@ -553,8 +554,9 @@ public:
   void setStatPost() override;
 
   // Generic method, assumes setter methods called earlier.
-  bool getNewParticles(Event& event, vector<Vec4> momIn,
-    vector<int> hIn, vector<Particle>& pNew, Rndm*, VinciaColour*) override;
+  bool getNewParticles(Event& event, const vector<Vec4>& momIn,
+    const vector<int>& hIn, vector<Particle>& pNew, Rndm*,
+    VinciaColour*) override;
 
   // Generate a new Q2 scale.
   double genQ2(int evTypeIn, double Q2MaxNow, Rndm* rndmPtr,
@@ -821,7 +823,8 @@ private:
   // Calculate acceptance probability.
   double pAcceptCalc(double antPhys);
   // Generate the full kinematics.
-  bool genFullKinematics(int kineMap, Event event, vector<Vec4> &pPost);
+  bool genFullKinematics(int kineMap, const Event& event,
+    vector<Vec4> &pPost);
   // Check if a trial is accepted.
   bool acceptTrial(Event& event);
   // Generate new particles for the antenna.
@@ -834,7 +837,7 @@ private:
   // this way because in case of resonance decays rest of vector
   // includes whole resonance system, whose polarisations we don't
   // want to change, i.e. they only recoil kinematically.
-  vector<int> genHelicities(AntennaFunction* antFunPtr);
+  void genHelicities(AntennaFunction* antFunPtr, vector<int>& hPost);
 
   // ME corrections.
   double getMEC(int iSys, const Event& event,
@@ -957,6 +960,10 @@ private:
 
   // Storage of the post-branching configuration while it is being built.
   vector<Particle> pNew;
+  // Work vectors for the trial branchings, reused between trials.
+  vector<Vec4>     pPreWork, pPostWork;
+  vector<int>      hPreWork, hPostWork, iOldWork;
+  vector<Particle> ptclsPostWork, stateNewWork, stateNowWork;
   // Total and MEC accept probability.
   vector<double> pAccept;
 
@@ -242,6 +242,21 @@ typedef map<int, vector<HistoryNode> > HistoryNodes;
 
 //==========================================================================
 
+// The outcome of clustering a single system, saved so that a system
+// that recurs in several colour flows is only clustered once.
+
+struct SystemHistory {
+  // Whether the clustering succeeded, and whether it stopped before
+  // reaching the Born topology.
+  bool success{false}, isIncomplete{false};
+  // Parton-shower approximation to the matrix element.
+  double ME2guess{0.};
+  // The sequence of history nodes, starting from the first node.
+  vector<HistoryNode> history;
+};
+
+//==========================================================================
+
 // History class for the Vincia shower.
 
 class VinciaHistory {
@@ -277,6 +292,11 @@ public:
   Event getNewProcess() {return newProcess;}
   bool doAbort() {return aborted;}
 
+  // Number of history nodes found by clustering, and number reused from
+  // systems already clustered for another colour flow.
+  int getNNodesVisited() const {return nNodesVisited;}
+  int getNNodesReused() const {return nNodesReused;}
+
 private:
 
   // Loop over colPerms and set historyBest.
@@ -315,6 +335,15 @@ private:
   // Construct history for a given colour permutation.
   tuple<bool, double, HistoryNodes> findHistoryPerm(ColourFlow& flow);
 
+  // Construct the history of a single system from its first node, or
+  // return the saved one if the system was met before.
+  const SystemHistory& findHistorySys(const HistoryNode& firstNode,
+    int iSys);
+
+  // Make the key of a system in the saved histories, from its first node.
+  void makeSystemKey(const HistoryNode& node, int iSys,
+    vector<double>& key) const;
+
   // Check if history failed merging scale cut.
   bool checkMergingCut(HistoryNodes& history);
 
@@ -430,6 +459,13 @@ private:
   // Flag to signal if something went wrong.
   bool aborted;
 
+  // Histories of the systems clustered so far, keyed by their first node.
+  map<vector<double>, SystemHistory> systemHistories;
+  vector<double> systemKey;
+
+  // Counters of history nodes found by clustering and reused.
+  int nNodesVisited{0}, nNodesReused{0};
+
 };
 
 //==========================================================================
@@ -1193,7 +1193,7 @@ public:
   // Method to check if a gluon splitting in the initial state (to get
   // rid of heavy quarks) is still possible after the current
   // branching.
-  bool checkHeavyQuarkPhaseSpace(vector<Particle> parts, int iSyst);
+  bool checkHeavyQuarkPhaseSpace(const vector<Particle>& parts, int iSyst);
 
   // Method to check if heavy quark left after passing the evolution window.
   bool heavyQuarkLeft(double qTrial);
@@ -1362,6 +1362,14 @@ private:
   vector<Particle> stateNew;
   VinciaClustering minClus;
 
+  // Work vectors for the trial branchings, reused between trials.
+  vector<Vec4>     recoilersWork, pOldWork, pNewWork;
+  vector<int>      iRecsWork, iOldWork, hBefWork, hUnpolWork, hNowWork;
+  vector<double>   invariantsWork, mNewWork;
+  vector<Particle> ptclsPostWork, partsWork;
+  // Copy of the event record, only needed if user hooks can veto.
+  Event            evtOldWork;
+
   // Flags to tell a few basic properties of each parton system.
   map<int, bool> isHardSys, isResonanceSys, polarisedSys, doMECsSys;
 
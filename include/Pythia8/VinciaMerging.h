@@ -56,6 +56,8 @@ class VinciaMerging : public Merging {
   // Statistics.
   map<int, double> historyCompTime;
   map<int, int> nHistories;
+  // History nodes found by clustering and reused between colour flows.
+  long nNodesVisited, nNodesReused;
 
   // Debug verbosity.
   int verbose;
@@ -0,0 +1,690 @@
+// BinaryEventFile.h is a part of the PYTHIA event generator.
+// Copyright (C) 2021 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// This file contains a compact binary format for storing the PYTHIA
+// event record, with the BinaryEventWriter class to write events to
+// file, and the BinaryEventReader class to read them back.
+// Events are stored in blocks. Inside a block each particle property is
+// stored as a separate column, which is byte shuffled and, if PYTHIA is
+// compiled with GZIP support, compressed with zlib. The reader memory
+// maps the file and can restore any event into an Event object.
+
+#ifndef Pythia8_BinaryEventFile_H
+#define Pythia8_BinaryEventFile_H
+
+// Generator includes.
+#include "Pythia8/Pythia.h"
+
+// Memory mapping of files.
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstring>
+
+// Compression.
+#ifdef GZIP
+#include <zlib.h>
+#endif
+
+namespace Pythia8 {
+
+//==========================================================================
+
+// Layout of the binary event format. Multibyte numbers are stored in
+// the byte order of the machine writing the file, which is checked
+// on reading.
+
+namespace BinaryEventFormat {
+
+  // File identification and format version.
+  static const char   MAGIC[9]   = "PY8EVBIN";
+  static const int    VERSION    = 1;
+  static const int    BYTEORDER  = 0x01020304;
+
+  // File flags.
+  static const int    SINGLEPRECISION = 1;
+
+  // Block compression schemes.
+  static const int    RAW = 0, ZLIB = 1;
+
+  // Number of columns of each type and level.
+  static const int    NEVTINT = 5, NEVTREAL = 9, NPRTINT = 9,
+                      NPRTREAL = 12, NJUNINT = 11;
+
+  // Byte shuffle n elements of size nByte, so that the first bytes of all
+  // elements come first, then all second bytes, and so on. Neighbouring
+  // numbers often share their leading bytes, which compresses well.
+  inline void shuffle(const char* in, char* out, size_t n, size_t nByte) {
+    for (size_t i = 0; i < n; ++i)
+      for (size_t j = 0; j < nByte; ++j) out[j * n + i] = in[i * nByte + j];
+  }
+
+  // Reverse the byte shuffle.
+  inline void unshuffle(const char* in, char* out, size_t n, size_t nByte) {
+    for (size_t i = 0; i < n; ++i)
+      for (size_t j = 0; j < nByte; ++j) out[i * nByte + j] = in[j * n + i];
+  }
+
+}
+
+//==========================================================================
+
+// The event information stored along with each event record.
+
+struct BinaryEventInfo {
+
+  // Process code, incoming partons and weights.
+  int code, id1, id2;
+  double weight;
+  vector<double> weights;
+
+  // Kinematics and couplings of the hard process.
+  double pTHat, x1, x2, QFac, alphaS, alphaEM;
+
+};
+
+//==========================================================================
+
+// Write events to a binary file. Events are collected column by column
+// in a block, which is written to file when eventsPerBlock events have
+// been added and when the writer is closed.
+
+class BinaryEventWriter {
+
+public:
+
+  // Constructor. With singlePrecision the particle momenta, masses,
+  // vertices and other real numbers are stored as floats, which halves
+  // the file size. The compression level runs from 0 (no compression)
+  // to 9 (best compression), and is ignored without GZIP support.
+  BinaryEventWriter(string fileName, int eventsPerBlockIn = 1000,
+    bool singlePrecisionIn = false, int compressionIn = 1)
+    : os(fileName.c_str(), ios::binary),
+    eventsPerBlock(max(1, eventsPerBlockIn)),
+    singlePrecision(singlePrecisionIn), compression(compressionIn),
+    hasHeader(false), nWeights(0), nEventBlock(0), nWritten(0),
+    nBytes(0) {
+    if (!os) cout << " BinaryEventWriter error: could not open file "
+                  << fileName << endl;
+  }
+
+  // Destructor writes the last block.
+  ~BinaryEventWriter() {close();}
+
+  // Check that the file is open.
+  bool isOpen() {return os.is_open() && os.good();}
+
+  // Add an event, optionally with information from an Info object.
+  bool write(const Event& event, const Info* infoPtr = nullptr);
+
+  // Add the current event of a Pythia object.
+  bool write(Pythia& pythia) {return write(pythia.event, &pythia.info);}
+
+  // Write the remaining events and close the file.
+  void close();
+
+  // Number of events written and file size so far.
+  long nEvents() const {return nWritten;}
+  size_t bytesWritten() const {return nBytes;}
+
+private:
+
+  // Write the file header.
+  void writeHeader(const Info* infoPtr);
+
+  // Write the current block of events.
+  void writeBlock();
+
+  // Write plain numbers or a shuffled column to the file or buffer.
+  template<typename T> void put(const T& x) {
+    os.write(reinterpret_cast<const char*>(&x), sizeof(T));
+    nBytes += sizeof(T);
+  }
+  template<typename T> void putColumn(const vector<T>& col) {
+    size_t nNow = rawBuffer.size();
+    rawBuffer.resize(nNow + col.size() * sizeof(T));
+    if (col.size() > 0) BinaryEventFormat::shuffle(
+      reinterpret_cast<const char*>(&col[0]), &rawBuffer[nNow], col.size(),
+      sizeof(T));
+  }
+
+  // Output file and settings.
+  ofstream os;
+  int  eventsPerBlock;
+  bool singlePrecision;
+  int  compression;
+
+  // Information on the weights.
+  bool hasHeader;
+  int  nWeights;
+
+  // Columns of the current block.
+  vector<int>    evtInt[BinaryEventFormat::NEVTINT];
+  vector<double> evtReal[BinaryEventFormat::NEVTREAL], evtWeights;
+  vector<int>    prtInt[BinaryEventFormat::NPRTINT];
+  vector<double> prtReal[BinaryEventFormat::NPRTREAL];
+  vector<float>  prtFloat[BinaryEventFormat::NPRTREAL];
+  vector<int>    junInt[BinaryEventFormat::NJUNINT];
+
+  // Buffers for writing a block.
+  vector<char> rawBuffer, zipBuffer;
+
+  // Counters.
+  int    nEventBlock;
+  long   nWritten;
+  size_t nBytes;
+
+};
+
+//--------------------------------------------------------------------------
+
+// Write the file header. The weight names are taken from the first event.
+
+inline void BinaryEventWriter::writeHeader(const Info* infoPtr) {
+
+  using namespace BinaryEventFormat;
+  hasHeader = true;
+  vector<string> names;
+  if (infoPtr != nullptr) for (int i = 0; i < infoPtr->numberOfWeights(); ++i)
+    names.push_back(infoPtr->weightNameByIndex(i));
+  nWeights = names.size();
+
+  os.write(MAGIC, 8);
+  nBytes += 8;
+  put(VERSION);
+  put(BYTEORDER);
+  put(singlePrecision ? SINGLEPRECISION : 0);
+  put(nWeights);
+  for (int i = 0; i < nWeights; ++i) {
+    int nChar = names[i].size();
+    put(nChar);
+    os.write(names[i].c_str(), nChar);
+    nBytes += nChar;
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
+// Add an event to the current block.
+
+inline bool BinaryEventWriter::write(const Event& event,
+  const Info* infoPtr) {
+
+  using namespace BinaryEventFormat;
+  if (!isOpen()) return false;
+  if (!hasHeader) writeHeader(infoPtr);
+
+  // Event-level information.
+  bool hasInfo = (infoPtr != nullptr);
+  int evtI[NEVTINT] = { event.size(), event.sizeJunction(),
+    hasInfo ? infoPtr->code() : 0, hasInfo ? infoPtr->id1() : 0,
+    hasInfo ? infoPtr->id2() : 0 };
+  double evtR[NEVTREAL] = { hasInfo ? infoPtr->weight() : 1.,
+    hasInfo ? infoPtr->pTHat() : 0., hasInfo ? infoPtr->x1() : 0.,
+    hasInfo ? infoPtr->x2() : 0., hasInfo ? infoPtr->QFac() : 0.,
+    hasInfo ? infoPtr->alphaS() : 0., hasInfo ? infoPtr->alphaEM() : 0.,
+    event.scale(), event.scaleSecond() };
+  for (int j = 0; j < NEVTINT; ++j) evtInt[j].push_back(evtI[j]);
+  for (int j = 0; j < NEVTREAL; ++j) evtReal[j].push_back(evtR[j]);
+  int nWeightsNow = hasInfo ? infoPtr->numberOfWeights() : 0;
+  for (int i = 0; i < nWeights; ++i) evtWeights.push_back( i < nWeightsNow
+    ? infoPtr->weightValueByIndex(i) : 0.);
+
+  // Particle properties.
+  for (int i = 0; i < event.size(); ++i) {
+    const Particle& pt = event[i];
+    prtInt[0].push_back(pt.id());
+    prtInt[1].push_back(pt.status());
+    prtInt[2].push_back(pt.mother1());
+    prtInt[3].push_back(pt.mother2());
+    prtInt[4].push_back(pt.daughter1());
+    prtInt[5].push_back(pt.daughter2());
+    prtInt[6].push_back(pt.col());
+    prtInt[7].push_back(pt.acol());
+    prtInt[8].push_back(pt.hasVertex() ? 1 : 0);
+    double prtR[NPRTREAL] = { pt.px(), pt.py(), pt.pz(), pt.e(), pt.m(),
+      pt.scale(), pt.pol(), pt.xProd(), pt.yProd(), pt.zProd(), pt.tProd(),
+      pt.tau() };
+    if (singlePrecision) for (int j = 0; j < NPRTREAL; ++j)
+      prtFloat[j].push_back(float(prtR[j]));
+    else for (int j = 0; j < NPRTREAL; ++j) prtReal[j].push_back(prtR[j]);
+  }
+
+  // Junctions.
+  for (int i = 0; i < event.sizeJunction(); ++i) {
+    const Junction& ju = event.getJunction(i);
+    junInt[0].push_back(ju.remains() ? 1 : 0);
+    junInt[1].push_back(ju.kind());
+    for (int j = 0; j < 3; ++j) {
+      junInt[2 + j].push_back(ju.col(j));
+      junInt[5 + j].push_back(ju.endCol(j));
+      junInt[8 + j].push_back(ju.status(j));
+    }
+  }
+
+  // Write the block when full.
+  ++nWritten;
+  if (++nEventBlock >= eventsPerBlock) writeBlock();
+  return isOpen();
+
+}
+
+//--------------------------------------------------------------------------
+
+// Write the current block: the number of events, the compression scheme,
+// the raw and stored sizes, and then the shuffled columns.
+
+inline void BinaryEventWriter::writeBlock() {
+
+  using namespace BinaryEventFormat;
+  if (nEventBlock == 0) return;
+
+  // Collect the shuffled columns.
+  rawBuffer.resize(0);
+  for (int j = 0; j < NEVTINT; ++j) putColumn(evtInt[j]);
+  for (int j = 0; j < NEVTREAL; ++j) putColumn(evtReal[j]);
+  putColumn(evtWeights);
+  for (int j = 0; j < NPRTINT; ++j) putColumn(prtInt[j]);
+  for (int j = 0; j < NPRTREAL; ++j) {
+    if (singlePrecision) putColumn(prtFloat[j]);
+    else putColumn(prtReal[j]);
+  }
+  for (int j = 0; j < NJUNINT; ++j) putColumn(junInt[j]);
+
+  // Compress the block if possible and useful.
+  int scheme = RAW;
+  const char* outPtr = &rawBuffer[0];
+  long long rawSize = rawBuffer.size(), storedSize = rawSize;
+#ifdef GZIP
+  if (compression > 0) {
+    uLongf zipSize = compressBound(rawSize);
+    zipBuffer.resize(zipSize);
+    if (compress2(reinterpret_cast<Bytef*>(&zipBuffer[0]), &zipSize,
+      reinterpret_cast<const Bytef*>(&rawBuffer[0]), rawSize,
+      min(compression, 9)) == Z_OK && (long long)zipSize < rawSize) {
+      scheme = ZLIB;
+      outPtr = &zipBuffer[0];
+      storedSize = zipSize;
+    }
+  }
+#endif
+
+  // Write the block.
+  put(nEventBlock);
+  put(scheme);
+  put(rawSize);
+  put(storedSize);
+  os.write(outPtr, storedSize);
+  nBytes += storedSize;
+
+  // Reset the columns for the next block.
+  for (int j = 0; j < NEVTINT; ++j) evtInt[j].resize(0);
+  for (int j = 0; j < NEVTREAL; ++j) evtReal[j].resize(0);
+  evtWeights.resize(0);
+  for (int j = 0; j < NPRTINT; ++j) prtInt[j].resize(0);
+  for (int j = 0; j < NPRTREAL; ++j) {
+    prtReal[j].resize(0);
+    prtFloat[j].resize(0);
+  }
+  for (int j = 0; j < NJUNINT; ++j) junInt[j].resize(0);
+  nEventBlock = 0;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Write the remaining events and close the file.
+
+inline void BinaryEventWriter::close() {
+
+  if (!os.is_open()) return;
+  if (!hasHeader) writeHeader(nullptr);
+  writeBlock();
+  os.close();
+
+}
+
+//==========================================================================
+
+// Read events from a binary file. The file is memory mapped, and blocks
+// are decoded when an event in them is requested. Events can be read
+// in sequence or by their number in the file.
+
+class BinaryEventReader {
+
+public:
+
+  // Constructor opens and maps the file, and locates all blocks.
+  BinaryEventReader(string fileName) : fd(-1), fileSize(0),
+    mapPtr(nullptr), isValid(false), singlePrecision(false),
+    iBlockNow(-1), iEventNext(0) {open(fileName);}
+
+  // Destructor releases the file.
+  ~BinaryEventReader() {
+    if (mapPtr != nullptr) munmap(mapPtr, fileSize);
+    if (fd >= 0) ::close(fd);
+  }
+
+  // Check that the file was opened and is valid.
+  bool isOpen() const {return isValid;}
+
+  // Number of events in the file, and names of the weights.
+  long nEvents() const {return blockFirst.size() > 0 ? blockFirst.back() : 0;}
+  int nWeights() const {return weightNames.size();}
+  string weightName(int i) const {return weightNames[i];}
+
+  // Read the next event, or the event with a given number.
+  bool next(Event& event) {return read(iEventNext, event);}
+  bool read(long iEvent, Event& event);
+
+  // Information on the last event read.
+  const BinaryEventInfo& info() const {return infoNow;}
+
+private:
+
+  // Map the file, read the header and locate the blocks.
+  bool open(string fileName);
+
+  // Check the numbers in a block header for consistency. Uncompressed
+  // blocks are stored as is, zlib cannot expand data by more than about
+  // a factor 1000, and all blocks must at least hold the event-level
+  // columns.
+  bool checkBlockHeader(int nEvt, int scheme, long long rawSize,
+    long long storedSize) const {
+    using namespace BinaryEventFormat;
+    if (nEvt < 0 || rawSize < 0 || storedSize < 0) return false;
+    if (scheme != RAW && scheme != ZLIB) return false;
+    if (scheme == RAW && rawSize != storedSize) return false;
+    if (scheme == ZLIB && rawSize / 1032 > storedSize + 1) return false;
+    long long nEvtBytes = NEVTINT * sizeof(int) + (NEVTREAL
+      + weightNames.size()) * sizeof(double);
+    return (nEvt == 0 || nEvt <= rawSize / nEvtBytes);
+  }
+
+  // Decode the columns of a block.
+  bool decodeBlock(int iBlock);
+
+  // Copy a shuffled column from the block to a vector.
+  template<typename T> void getColumn(const char*& in, vector<T>& col,
+    size_t n) {
+    col.resize(n);
+    if (n > 0) BinaryEventFormat::unshuffle(in,
+      reinterpret_cast<char*>(&col[0]), n, sizeof(T));
+    in += n * sizeof(T);
+  }
+
+  // The mapped file.
+  int    fd;
+  size_t fileSize;
+  void*  mapPtr;
+  bool   isValid, singlePrecision;
+  vector<string> weightNames;
+
+  // Block positions in the file. blockFirst has an extra final entry
+  // with the total number of events.
+  vector<size_t> blockOffset;
+  vector<long>   blockFirst;
+
+  // Columns of the current block, and the first particle and junction
+  // of each event in it.
+  int            iBlockNow;
+  vector<int>    evtInt[BinaryEventFormat::NEVTINT];
+  vector<double> evtReal[BinaryEventFormat::NEVTREAL], evtWeights;
+  vector<int>    prtInt[BinaryEventFormat::NPRTINT];
+  vector<double> prtReal[BinaryEventFormat::NPRTREAL];
+  vector<float>  prtFloat[BinaryEventFormat::NPRTREAL];
+  vector<int>    junInt[BinaryEventFormat::NJUNINT];
+  vector<int>    firstPrt, firstJun;
+  vector<char>   rawBuffer;
+
+  // The next event to read, and information on the last event.
+  long iEventNext;
+  BinaryEventInfo infoNow;
+
+};
+
+//--------------------------------------------------------------------------
+
+// Map the file, read the header and locate the blocks.
+
+inline bool BinaryEventReader::open(string fileName) {
+
+  using namespace BinaryEventFormat;
+
+  // Map the file.
+  fd = ::open(fileName.c_str(), O_RDONLY);
+  struct stat fileStat;
+  if (fd < 0 || fstat(fd, &fileStat) != 0) {
+    cout << " BinaryEventReader error: could not open file "
+         << fileName << endl;
+    return false;
+  }
+  fileSize = fileStat.st_size;
+  if (fileSize > 0) mapPtr = mmap(nullptr, fileSize, PROT_READ, MAP_SHARED,
+    fd, 0);
+  if (mapPtr == MAP_FAILED || mapPtr == nullptr) {
+    mapPtr = nullptr;
+    cout << " BinaryEventReader error: could not map file "
+         << fileName << endl;
+    return false;
+  }
+  const char* base = static_cast<const char*>(mapPtr);
+
+  // Read a number at a given position, checking the file size.
+  size_t pos = 0;
+  bool ok = true;
+  auto get = [&](void* x, size_t nByte) {
+    if (pos + nByte > fileSize) { ok = false; return; }
+    memcpy(x, base + pos, nByte);
+    pos += nByte;
+  };
+
+  // Check the file header.
+  int version = 0, byteOrder = 0, flags = 0, nWgt = 0;
+  if (fileSize < 8 || memcmp(base, MAGIC, 8) != 0) ok = false;
+  pos = 8;
+  get(&version, sizeof(int));
+  get(&byteOrder, sizeof(int));
+  get(&flags, sizeof(int));
+  get(&nWgt, sizeof(int));
+  if (!ok || version > VERSION || byteOrder != BYTEORDER || nWgt < 0) {
+    cout << " BinaryEventReader error: " << fileName << " is not a valid "
+         << "event file for this version and machine" << endl;
+    return false;
+  }
+  singlePrecision = (flags & SINGLEPRECISION) != 0;
+  for (int i = 0; i < nWgt && ok; ++i) {
+    int nChar = 0;
+    get(&nChar, sizeof(int));
+    if (!ok || nChar < 0 || pos + nChar > fileSize) { ok = false; break; }
+    weightNames.push_back(string(base + pos, nChar));
+    pos += nChar;
+  }
+
+  // Locate the blocks from their headers.
+  blockFirst.push_back(0);
+  while (ok && pos < fileSize) {
+    int nEvt = 0, scheme = 0;
+    long long rawSize = 0, storedSize = 0;
+    size_t posBlock = pos;
+    get(&nEvt, sizeof(int));
+    get(&scheme, sizeof(int));
+    get(&rawSize, sizeof(long long));
+    get(&storedSize, sizeof(long long));
+    if (!ok || storedSize < 0 || pos + storedSize > fileSize) {
+      ok = false;
+      break;
+    }
+
+    // Reject inconsistent block headers.
+    if (!checkBlockHeader(nEvt, scheme, rawSize, storedSize)) {
+      cout << " BinaryEventReader error: " << fileName << " has a corrupt "
+           << "block header" << endl;
+      return false;
+    }
+    blockOffset.push_back(posBlock);
+    blockFirst.push_back(blockFirst.back() + nEvt);
+    pos += storedSize;
+  }
+  if (!ok) cout << " BinaryEventReader warning: " << fileName
+                << " is truncated; only complete blocks are read" << endl;
+  isValid = true;
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Decode a block into columns.
+
+inline bool BinaryEventReader::decodeBlock(int iBlock) {
+
+  using namespace BinaryEventFormat;
+  const char* in = static_cast<const char*>(mapPtr) + blockOffset[iBlock];
+  int nEvt, scheme;
+  long long rawSize, storedSize;
+  memcpy(&nEvt, in, sizeof(int));
+  memcpy(&scheme, in + sizeof(int), sizeof(int));
+  memcpy(&rawSize, in + 2 * sizeof(int), sizeof(long long));
+  memcpy(&storedSize, in + 2 * sizeof(int) + sizeof(long long),
+    sizeof(long long));
+  in += 2 * sizeof(int) + 2 * sizeof(long long);
+  if (!checkBlockHeader(nEvt, scheme, rawSize, storedSize)) {
+    cout << " BinaryEventReader error: corrupt block header" << endl;
+    return false;
+  }
+
+  // Uncompress the block if needed. Uncompressed blocks are used directly.
+  if (scheme == ZLIB) {
+#ifdef GZIP
+    rawBuffer.resize(rawSize);
+    uLongf rawLen = rawSize;
+    if (uncompress(reinterpret_cast<Bytef*>(&rawBuffer[0]), &rawLen,
+      reinterpret_cast<const Bytef*>(in), storedSize) != Z_OK
+      || (long long)rawLen != rawSize) {
+      cout << " BinaryEventReader error: corrupt block" << endl;
+      return false;
+    }
+    in = &rawBuffer[0];
+#else
+    cout << " BinaryEventReader error: compressed file, but no GZIP "
+         << "support" << endl;
+    return false;
+#endif
+  }
+  const char* inEnd = in + rawSize;
+
+  // Event-level columns, and the first particle and junction of each.
+  // The particle and junction columns must fit in what remains.
+  for (int j = 0; j < NEVTINT; ++j) getColumn(in, evtInt[j], nEvt);
+  for (int j = 0; j < NEVTREAL; ++j) getColumn(in, evtReal[j], nEvt);
+  getColumn(in, evtWeights, size_t(nEvt) * weightNames.size());
+  size_t nByteLeft = inEnd - in;
+  size_t nBytePrt  = NPRTINT * sizeof(int) + NPRTREAL
+    * (singlePrecision ? sizeof(float) : sizeof(double));
+  size_t nByteJun  = NJUNINT * sizeof(int);
+  size_t nPrt = 0, nJun = 0;
+  firstPrt.resize(nEvt + 1);
+  firstJun.resize(nEvt + 1);
+  firstPrt[0] = firstJun[0] = 0;
+  for (int i = 0; i < nEvt; ++i) {
+    bool isCorrupt = (evtInt[0][i] < 0 || evtInt[1][i] < 0);
+    if (!isCorrupt) {
+      nPrt += evtInt[0][i];
+      nJun += evtInt[1][i];
+      isCorrupt = (nPrt * nBytePrt + nJun * nByteJun > nByteLeft);
+    }
+    if (isCorrupt) {
+      cout << " BinaryEventReader error: corrupt block" << endl;
+      return false;
+    }
+    firstPrt[i + 1] = nPrt;
+    firstJun[i + 1] = nJun;
+  }
+
+  // Particle and junction columns.
+  for (int j = 0; j < NPRTINT; ++j) getColumn(in, prtInt[j], nPrt);
+  for (int j = 0; j < NPRTREAL; ++j) {
+    if (singlePrecision) getColumn(in, prtFloat[j], nPrt);
+    else getColumn(in, prtReal[j], nPrt);
+  }
+  for (int j = 0; j < NJUNINT; ++j) getColumn(in, junInt[j], nJun);
+  iBlockNow = iBlock;
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Restore an event record and its information.
+
+inline bool BinaryEventReader::read(long iEvent, Event& event) {
+
+  using namespace BinaryEventFormat;
+  if (!isValid || iEvent < 0 || iEvent >= nEvents()) return false;
+
+  // Find and decode the block containing the event.
+  int iBlock = iBlockNow;
+  if (iBlock < 0 || iEvent < blockFirst[iBlock]
+    || iEvent >= blockFirst[iBlock + 1]) {
+    iBlock = upper_bound(blockFirst.begin(), blockFirst.end(), iEvent)
+      - blockFirst.begin() - 1;
+    if (!decodeBlock(iBlock)) return false;
+  }
+  int iEvt = iEvent - blockFirst[iBlock];
+
+  // Restore the particles.
+  event.clear();
+  for (int i = firstPrt[iEvt]; i < firstPrt[iEvt + 1]; ++i) {
+    double prtR[NPRTREAL];
+    for (int j = 0; j < NPRTREAL; ++j) prtR[j] = singlePrecision
+      ? double(prtFloat[j][i]) : prtReal[j][i];
+    event.append( prtInt[0][i], prtInt[1][i], prtInt[2][i], prtInt[3][i],
+      prtInt[4][i], prtInt[5][i], prtInt[6][i], prtInt[7][i], prtR[0],
+      prtR[1], prtR[2], prtR[3], prtR[4], prtR[5], prtR[6]);
+    if (prtInt[8][i] != 0) event.back().vProd( prtR[7], prtR[8], prtR[9],
+      prtR[10]);
+    event.back().tau(prtR[11]);
+  }
+
+  // Restore the junctions.
+  for (int i = firstJun[iEvt]; i < firstJun[iEvt + 1]; ++i) {
+    Junction ju( junInt[1][i], junInt[2][i], junInt[3][i], junInt[4][i]);
+    ju.remains(junInt[0][i] != 0);
+    for (int j = 0; j < 3; ++j) {
+      ju.endCol(j, junInt[5 + j][i]);
+      ju.status(j, junInt[8 + j][i]);
+    }
+    event.appendJunction(ju);
+  }
+  event.scale(evtReal[7][iEvt]);
+  event.scaleSecond(evtReal[8][iEvt]);
+
+  // Restore the event information.
+  infoNow.code    = evtInt[2][iEvt];
+  infoNow.id1     = evtInt[3][iEvt];
+  infoNow.id2     = evtInt[4][iEvt];
+  infoNow.weight  = evtReal[0][iEvt];
+  infoNow.pTHat   = evtReal[1][iEvt];
+  infoNow.x1      = evtReal[2][iEvt];
+  infoNow.x2      = evtReal[3][iEvt];
+  infoNow.QFac    = evtReal[4][iEvt];
+  infoNow.alphaS  = evtReal[5][iEvt];
+  infoNow.alphaEM = evtReal[6][iEvt];
+  size_t nWgt = weightNames.size();
+  infoNow.weights.assign( evtWeights.begin() + iEvt * nWgt,
+    evtWeights.begin() + (iEvt + 1) * nWgt);
+  iEventNext = iEvent + 1;
+  return true;
+
+}
+
+//==========================================================================
+
+} // end namespace Pythia8
+
+#endif // Pythia8_BinaryEventFile_H
@@ -38,7 +38,8 @@ public:
   Pythia8ToHepMC3(): m_internal_event_number(0), m_print_inconsistency(true),
     m_free_parton_warnings(true), m_crash_on_problem(false),
     m_convert_gluon_to_0(false), m_store_pdf(true), m_store_proc(true),
-    m_store_xsec(true), m_store_weights(true) {}
+    m_store_xsec(true), m_store_weights(true), m_store_flow(true),
+    m_final_state_only(false) {}
   virtual ~Pythia8ToHepMC3() {}
 
   // The recommended method to convert Pythia events into HepMC3 ones.
@@ -93,20 +94,29 @@ public:
       evt->set_heavy_ion(ion);
     }
 
-    // 2. Fill particle information.
-    std::vector<GenParticlePtr> hepevt_particles;
-    hepevt_particles.reserve( pyev.size() );
+    // 2. Fill particle information. In the final-state-only mode only
+    // the beams, the final particles and the selected history are kept.
+    std::vector<GenParticlePtr>& hepevt_particles = m_particles;
+    hepevt_particles.resize( pyev.size() );
+    if (m_final_state_only) select_particles( pyev);
     for(int i = 0; i < pyev.size(); ++i) {
-      hepevt_particles.push_back( std::make_shared<GenParticle>(
+      if (m_final_state_only && !m_keep[i]) continue;
+      hepevt_particles[i] = std::make_shared<GenParticle>(
         FourVector( pyev[i].px(), pyev[i].py(), pyev[i].pz(), pyev[i].e() ),
-        pyev[i].id(), pyev[i].statusHepMC() ) );
+        pyev[i].id(), pyev[i].statusHepMC() );
       hepevt_particles[i]->set_generated_mass( pyev[i].m() );
     }
 
     // 3. Fill vertex information.
-    std::vector<GenVertexPtr> vertex_cache;
+    std::vector<GenVertexPtr>& vertex_cache = m_vertices;
     for (int i = 1; i < pyev.size(); ++i) {
-      std::vector<int> mothers = pyev[i].motherList();
+      if (m_final_state_only && !m_keep[i]) continue;
+      std::vector<int> mothers;
+      if (m_final_state_only) {
+        // Attach to the nearest kept ancestor, or else to the beams.
+        if (i > 2) mothers.push_back(m_ancestor[i]);
+        if (i > 2 && m_ancestor[i] == 0) mothers = {1, 2};
+      } else mothers = pyev[i].motherList();
       if (mothers.size()) {
         GenVertexPtr prod_vtx = hepevt_particles[mothers[0]]->end_vertex();
         if (!prod_vtx) {
@@ -126,7 +136,10 @@ public:
     }
 
     // Reserve memory for the event.
-    evt->reserve( hepevt_particles.size(), vertex_cache.size() );
+    int nParticle = pyev.size();
+    if (m_final_state_only) nParticle = count( m_keep.begin(), m_keep.end(),
+      true);
+    evt->reserve( nParticle, vertex_cache.size() );
 
     // Here we assume that the first two particles are the beam particles.
     vector<GenParticlePtr> beam_particles;
@@ -136,7 +149,8 @@ public:
     // Add particles and vertices in topological order.
     evt->add_tree( beam_particles );
     // Attributes should be set after adding the particles to event.
-    for (int i = 0; i < pyev.size(); ++i) {
+    if (m_store_flow) for (int i = 0; i < pyev.size(); ++i) {
+      if (!hepevt_particles[i]) continue;
       /* TODO: Set polarization */
       // Colour flow uses index 1 and 2.
       int colType = pyev[i].colType();
@@ -159,6 +173,7 @@ public:
     // mothers or daughters. These need to be attached to a vertex, or else
     // they will never become part of the event.
     for (int i = 1; i < pyev.size(); ++i) {
+      if (m_final_state_only && !m_keep[i]) continue;
 
       // Check for particles not added to the event.
       // NOTE: We have to check if this step makes any sense in
@@ -239,6 +254,10 @@ public:
       }
     }
 
+    // Release the particles, but keep the memory for the next event.
+    hepevt_particles.clear();
+    vertex_cache.clear();
+
     // Done.
     return true;
   }
@@ -252,6 +271,8 @@ public:
   bool store_proc()           const { return m_store_proc; }
   bool store_xsec()           const { return m_store_xsec; }
   bool store_weights()        const { return m_store_weights; }
+  bool store_flow()           const { return m_store_flow; }
+  bool final_state_only()     const { return m_final_state_only; }
 
   // Set values for some switches.
   void set_print_inconsistency(bool b = true)  { m_print_inconsistency  = b; }
@@ -262,6 +283,14 @@ public:
   void set_store_proc(bool b = true)           { m_store_proc           = b; }
   void set_store_xsec(bool b = true)           { m_store_xsec           = b; }
   void set_store_weights(bool b = true)        { m_store_weights        = b; }
+  void set_store_flow(bool b = true)           { m_store_flow           = b; }
+
+  // Only store the beams and final-state particles, plus particles with
+  // the given absolute status codes, e.g. 21 - 23 for the hard process.
+  // Each particle is attached to its nearest stored ancestor.
+  void set_final_state_only(bool b = true,
+    std::vector<int> keepStatus = std::vector<int>()) {
+    m_final_state_only = b; m_keep_status = keepStatus; }
 
 private:
 
@@ -272,11 +301,38 @@ private:
   // Use of copy constructor is not allowed.
   Pythia8ToHepMC3( const Pythia8ToHepMC3& ) {}
 
+  // Select the particles to store in the final-state-only mode, and find
+  // the nearest selected ancestor of each, with 0 for the beams.
+  void select_particles( Pythia8::Event& pyev) {
+    int n = pyev.size();
+    m_keep.assign( n, false);
+    m_ancestor.assign( n, 0);
+    for (int i = 1; i < n; ++i) {
+      m_keep[i] = (i <= 2 || pyev[i].isFinal());
+      for (unsigned int j = 0; j < m_keep_status.size() && !m_keep[i]; ++j)
+        if (pyev[i].statusAbs() == m_keep_status[j]) m_keep[i] = true;
+    }
+    for (int i = 3; i < n; ++i) {
+      if (!m_keep[i]) continue;
+      int iAnc = pyev[i].mother1();
+      for (int nStep = 0; iAnc > 2 && !m_keep[iAnc] && nStep < n; ++nStep)
+        iAnc = pyev[iAnc].mother1();
+      m_ancestor[i] = (iAnc > 2 && iAnc < i && m_keep[iAnc]) ? iAnc : 0;
+    }
+  }
+
   // Data members.
   int  m_internal_event_number;
   bool m_print_inconsistency, m_free_parton_warnings, m_crash_on_problem,
        m_convert_gluon_to_0, m_store_pdf, m_store_proc, m_store_xsec,
-       m_store_weights;
+       m_store_weights, m_store_flow, m_final_state_only;
+  std::vector<int> m_keep_status;
+
+  // Work vectors, kept to reuse their memory between events.
+  std::vector<GenParticlePtr> m_particles;
+  std::vector<GenVertexPtr>   m_vertices;
+  std::vector<bool> m_keep;
+  std::vector<int>  m_ancestor;
 
 };
 
@@ -308,11 +364,12 @@ public:
   typedef shared_ptr<Writer> WriterPtr;
 
   // The empty constructor does not creat an aoutput stream.
-  Pythia8ToHepMC() : runinfo(make_shared<HepMC3::GenRunInfo>()) {}
+  Pythia8ToHepMC() : runinfo(make_shared<HepMC3::GenRunInfo>()),
+    reuseEvent(false) {}
 
   // Construct an object with an internal output stream.
   Pythia8ToHepMC(string filename, OutputType ft = ascii3)
-    : runinfo(make_shared<HepMC3::GenRunInfo>()) {
+    : runinfo(make_shared<HepMC3::GenRunInfo>()), reuseEvent(false) {
     setNewFile(filename, ft);
   }
 
@@ -334,7 +391,8 @@ public:
   // Create a new GenEvent object and fill it with information from
   // the given Pythia object.
   bool fillNextEvent(Pythia & pythia) {
-    geneve = make_shared<HepMC3::GenEvent>(runinfo);
+    if (reuseEvent && geneve) geneve->clear();
+    else geneve = make_shared<HepMC3::GenEvent>(runinfo);
     if (runinfo->weight_names().size() == 0)
       setWeightNames(pythia.info.weightNameVector());
     return fill_next_event(pythia, *geneve);
@@ -354,6 +412,11 @@ public:
     return !writerPtr->failed();
   }
 
+  // Clear and refill the same GenEvent for each new event, rather than
+  // creating a new one. References to the previous event are then no
+  // longer valid.
+  void setReuseEvent(bool reuseEventIn = true) {reuseEvent = reuseEventIn;}
+
   // Get a reference to the current GenEvent.
   GenEvent & event() {
     return *geneve;
@@ -436,6 +499,9 @@ private:
   // The current run info.
   shared_ptr<HepMC3::GenRunInfo> runinfo;
 
+  // Reuse the GenEvent between events.
+  bool reuseEvent;
+
 };
 
 }
@@ -58,12 +58,10 @@ void HJSlowJet::findNext() {
     dMin = 1.0/TINY;
     // Remove the possibility of choosing a beam clustering
     for (int i = 1; i < clSize; ++i) {
-      for (int j = 0; j < i; ++j) {
-        if (dij[i*(i-1)/2 + j] < dMin) {
-          iMin = i;
-          jMin = j;
-          dMin = dij[i*(i-1)/2 + j];
-        }
+      if (dNN[i] < dMin) {
+        iMin = i;
+        jMin = jNN[i];
+        dMin = dNN[i];
       }
     }
 
@@ -13,6 +13,9 @@
 // Generator includes.
 #include "Pythia8/Pythia.h"
 
+// Standard library includes.
+#include <future>
+
 namespace Pythia8 {
 
 //==========================================================================
@@ -24,14 +27,20 @@ class LHAupH5 : public Pythia8::LHAup {
 
  public:
 
+  // Events are read in chunks of chunkSizeIn events, to limit the memory
+  // footprint for large files. The default 0 reads all readSizeIn events
+  // at once. With prefetchIn on, the next chunk is read in a separate
+  // thread while the events of the current one are used.
   LHAupH5(HighFive::File* h5fileIn, size_t firstEventIn, size_t readSizeIn,
-    string versionIn = "") :
+    string versionIn = "", size_t chunkSizeIn = 0, bool prefetchIn = false) :
     nTrials(0), nRead(0), isOldFormat(h5fileIn->exist("/index")),
     particleSav(h5fileIn->getGroup("particle")),
     eventSav(h5fileIn->getGroup("event")),
     initSav(h5fileIn->getGroup("init")),
     procInfoSav(h5fileIn->getGroup("procInfo")),
-    readSizeSav(readSizeIn), firstEventSav(firstEventIn), fileSav(h5fileIn) {
+    readSizeSav(readSizeIn), firstEventSav(firstEventIn),
+    chunkSizeSav(chunkSizeIn), chunkFirstSav(0), chunkSizeNow(0),
+    nextFirstSav(0), prefetchSav(prefetchIn), fileSav(h5fileIn) {
 
     // Check if version number exists in event file.
     valid = false;
@@ -61,22 +70,21 @@ class LHAupH5 : public Pythia8::LHAup {
          << (hasMultiWts?"supports":"does not support")
          << " multi-weights." << endl;
 
-    hid_t dspace;
     if( !isOldFormat ) {
       DataSet npLO  = procInfoSav.getDataSet("npLO");
       DataSet npNLO = procInfoSav.getDataSet("npNLO");
       npLO.read(npLOSav);
       npNLO.read(npNLOSav);
-      dspace = H5Dget_space(fileSav->getDataSet("event/start").getId());
     } else {
       indexSav      = fileSav->getGroup("index");
-      dspace = H5Dget_space(fileSav->getDataSet("index/start").getId());
     }
     // Check if size of read is compatible.
-    if (readSizeIn > H5Sget_simple_extent_npoints(dspace) ) {
+    if (firstEventIn + readSizeIn > nEvents(h5fileIn)) {
       cout << "H5 size request incompatible with file.\n";
       return;
     }
+    if (chunkSizeSav == 0 || chunkSizeSav > readSizeSav)
+      chunkSizeSav = readSizeSav;
 
     // Check for multiweights.
     if ( fileSav->exist("event/weight") && hasMultiWts ) {
@@ -86,26 +94,68 @@ class LHAupH5 : public Pythia8::LHAup {
       a.read(weightsNames);
     }
 
-    // This reads and holds the information of readSize events,
+    // This reads and holds the information of the first chunk of events,
     // starting from firstEvent.
-    if (!isOldFormat) {
-      lheEvts2Sav = LHEH5::readEvents2(particleSav, eventSav,
-        firstEventSav, readSizeSav, npLOSav, npNLOSav, hasMultiWts);
-
-    } else lheEvtsSav = LHEH5::readEvents(indexSav, particleSav, eventSav,
-        firstEventSav, readSizeSav);
-    valid = true;
+    valid = readChunk(0);
 
   }
 
+  // Wait for a chunk still being read, before the groups it uses are gone.
+  ~LHAupH5() { if (nextChunk.valid()) nextChunk.wait(); }
+
   // Read and set the info from init and procInfo.
   bool setInit() override;
   bool setEvent(int idProc=0) override;
   void forceStrategy(int strategyIn) {setStrategy(strategyIn);}
   size_t getTrials() {return nTrials;}
 
+  // Total number of events stored in a file.
+  static size_t nEvents(HighFive::File* h5fileIn) {
+    hid_t dspace = H5Dget_space(h5fileIn->getDataSet(
+      h5fileIn->exist("/index") ? "index/start" : "event/start").getId());
+    size_t nEvt = H5Sget_simple_extent_npoints(dspace);
+    H5Sclose(dspace);
+    return nEvt;
+  }
+
+  // Split nEventsIn events into nShards disjoint ranges of almost equal
+  // size, and return the first event and number of events of shard iShard,
+  // e.g. to be used as firstEventIn and readSizeIn by independent workers.
+  static void shardRange(size_t nEventsIn, int iShard, int nShards,
+    size_t& firstEventOut, size_t& readSizeOut) {
+    size_t nPer = nEventsIn / nShards, nRem = nEventsIn % nShards;
+    size_t iSh  = size_t(iShard);
+    firstEventOut = iSh * nPer + min(iSh, nRem);
+    readSizeOut   = nPer + (iSh < nRem ? 1 : 0);
+  }
+  static void shardRange(HighFive::File* h5fileIn, int iShard, int nShards,
+    size_t& firstEventOut, size_t& readSizeOut) {
+    shardRange(nEvents(h5fileIn), iShard, nShards, firstEventOut,
+      readSizeOut);}
+
  private:
 
+  // The events of one chunk, in the old or the new format.
+  struct Chunk {
+    LHEH5::Events  evts;
+    LHEH5::Events2 evts2;
+  };
+
+  // Read nEvt events starting at event iFirst of the selected range from
+  // the file. This is the only method used by the prefetch thread.
+  Chunk loadChunk(size_t iFirst, size_t nEvt);
+
+  // Make the chunk of events starting at event iFirst of the selected
+  // range the current one, using the prefetched chunk if it is this one.
+  bool readChunk(size_t iFirst);
+
+  // Start to read the chunk after the current one in a separate thread.
+  void prefetchChunk();
+
+  // Get the header of event iEvent of the selected range, reading a new
+  // chunk of events if necessary.
+  LHEH5::EventHeader eventHeader(size_t iEvent);
+
   // HDF5 file.
   HighFive::File* fileSav{};
 
@@ -118,12 +168,18 @@ class LHAupH5 : public Pythia8::LHAup {
 
   // Info for reader.
   size_t         readSizeSav, firstEventSav, nTrials;
+  size_t         chunkSizeSav, chunkFirstSav, chunkSizeNow;
   int            npLOSav, npNLOSav;
+
+  // Prefetching of the next chunk, and where that chunk starts.
+  size_t         nextFirstSav;
+  bool           prefetchSav;
+  std::future<Chunk> nextChunk;
   bool           valid, isOldFormat, hasMultiWts;
   string         versionSav;
 
   // Additional parameters.
-  int nRead;
+  size_t nRead;
 
   // Multiweight vector. Reset each event.
   vector<double> weightsSav;
@@ -184,6 +240,78 @@ bool LHAupH5::setInit() {
 
 //--------------------------------------------------------------------------
 
+// Read a chunk of events from the file.
+
+LHAupH5::Chunk LHAupH5::loadChunk(size_t iFirst, size_t nEvt) {
+
+  Chunk chunk;
+  if (!isOldFormat) chunk.evts2 = LHEH5::readEvents2(particleSav, eventSav,
+    firstEventSav + iFirst, nEvt, npLOSav, npNLOSav, hasMultiWts);
+  else chunk.evts = LHEH5::readEvents(indexSav, particleSav, eventSav,
+    firstEventSav + iFirst, nEvt);
+  return chunk;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Make a chunk of events the current one. The previous chunk is released,
+// so that only the current chunk, and the next one when prefetching, are
+// held in memory.
+
+bool LHAupH5::readChunk(size_t iFirst) {
+
+  if (iFirst >= readSizeSav) return false;
+  size_t nEvt = min(chunkSizeSav, readSizeSav - iFirst);
+  Chunk chunk;
+
+  // Take over the prefetched chunk, if it is the right one. Else read
+  // the chunk now, but never while a prefetch still reads from the file.
+  if (nextChunk.valid() && nextFirstSav == iFirst) chunk = nextChunk.get();
+  else {
+    if (nextChunk.valid()) nextChunk.get();
+    chunk = loadChunk(iFirst, nEvt);
+  }
+  chunkFirstSav = iFirst;
+  chunkSizeNow  = nEvt;
+  lheEvts2Sav   = std::move(chunk.evts2);
+  lheEvtsSav    = std::move(chunk.evts);
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Start to read the next chunk in a separate thread. Only the prefetch
+// thread reads from the file until the chunk is taken over by readChunk.
+
+void LHAupH5::prefetchChunk() {
+
+  if (!prefetchSav || nextChunk.valid()) return;
+  size_t iFirst = chunkFirstSav + chunkSizeNow;
+  if (iFirst >= readSizeSav) return;
+  nextFirstSav = iFirst;
+  nextChunk = std::async(std::launch::async, &LHAupH5::loadChunk, this,
+    iFirst, min(chunkSizeSav, readSizeSav - iFirst));
+
+}
+
+//--------------------------------------------------------------------------
+
+// Get an event header, reading the next chunk when the current one
+// is exhausted.
+
+LHEH5::EventHeader LHAupH5::eventHeader(size_t iEvent) {
+
+  if (iEvent >= chunkFirstSav + chunkSizeNow) readChunk(iEvent);
+  int iLocal = int(iEvent - chunkFirstSav);
+  return !isOldFormat ? lheEvts2Sav.mkEventHeader(iLocal)
+    : lheEvtsSav.mkEventHeader(iLocal);
+
+}
+
+//--------------------------------------------------------------------------
+
 // Read an event.
 
 bool LHAupH5::setEvent(int idProc) {
@@ -191,15 +319,13 @@ bool LHAupH5::setEvent(int idProc) {
   // Equivalent of end of file.
   if (!valid) return false;
   if (nRead >= readSizeSav) return false;
-  LHEH5::EventHeader evtHeader = !isOldFormat ?
-    lheEvts2Sav.mkEventHeader(nRead) : lheEvtsSav.mkEventHeader(nRead);
+  LHEH5::EventHeader evtHeader = eventHeader(nRead);
   weightsSav = evtHeader.weights;
   nTrials += evtHeader.trials;
   // Skip zero-weight events, but add trials.
   while (weightsSav[0] == 0. && nRead < readSizeSav - 1) {
     ++nRead;
-    evtHeader  = !isOldFormat ?
-      lheEvts2Sav.mkEventHeader(nRead) : lheEvtsSav.mkEventHeader(nRead);
+    evtHeader  = eventHeader(nRead);
     weightsSav = evtHeader.weights;
     nTrials   += evtHeader.trials;
   }
@@ -216,8 +342,9 @@ bool LHAupH5::setEvent(int idProc) {
   setProcess(idprupSave, xwgtupSave, scalupSave, aqedupSave, aqcdupSave);
   double scalein = -1.;
   vector<LHEH5::Particle> particles;
-  particles = !isOldFormat ? lheEvts2Sav.mkEvent(nRead)
-    : lheEvtsSav.mkEvent(nRead);
+  size_t iLocal = nRead - chunkFirstSav;
+  particles = !isOldFormat ? lheEvts2Sav.mkEvent(iLocal)
+    : lheEvtsSav.mkEvent(iLocal);
 
   // Set particles.
   int nPtcls = 0;
@@ -241,6 +368,10 @@ bool LHAupH5::setEvent(int idProc) {
   scalesNow.mups  = evtHeader.scale;
   infoPtr->scales = &scalesNow;
   ++nRead;
+
+  // Optionally read the next chunk while this one is used. Not started
+  // earlier, since setInit also reads from the file.
+  prefetchChunk();
   return true;
 
 }
@@ -40,6 +40,10 @@ public:
   bool initVincia() override;
   // Get the matrix element squared for a particle state.
   double me2Vincia(vector<Particle> state, int nIn) override;
+  // Get the matrix elements squared for several particle states. The
+  // process is only looked up again when the flavours change.
+  void me2VinciaBatch(const vector< vector<Particle> >& states, int nIn,
+    vector<double>& me2s) override;
   // Check if the process is available.
   bool hasProcessVincia(vector<int> idIn, vector<int> idOut,
     set<int> sChan) override;
@@ -58,6 +62,11 @@ public:
 
 private:
 
+  // Get the matrix element squared for a particle state, optionally
+  // for an already accessed process.
+  double me2VinciaProcess(const vector<Particle>& state, int nIn,
+    const PY8MEs_namespace::process_accessor* procPtr);
+
   PY8MEs_namespace::PY8MEs* libPtr;
   PARS* modelPtr;
 
@@ -122,6 +131,9 @@ bool ShowerMEsMadgraph::initVincia() {
   libPtr->seProcessesIncludeSymmetryFactors(false);
   libPtr->seProcessesIncludeHelicityAveragingFactors(false);
   libPtr->seProcessesIncludeColorAveragingFactors(false);
+  // Optionally skip helicity configurations found to vanish.
+  libPtr->setProcessesHelicityPruning(
+    settingsPtr->flag("Vincia:pruneMEhelicities"));
 
   return true;
 
@@ -159,6 +171,48 @@ PY8MEs_namespace::PY8ME* ShowerMEsMadgraph::getProcess(
 // Get the matrix element squared for a particle state.
 
 double ShowerMEsMadgraph::me2Vincia(vector<Particle> state, int nIn) {
+  return me2VinciaProcess(state, nIn, nullptr);}
+
+//--------------------------------------------------------------------------
+
+// Get the matrix elements squared for several particle states.
+
+void ShowerMEsMadgraph::me2VinciaBatch(
+  const vector< vector<Particle> >& states, int nIn, vector<double>& me2s) {
+
+  me2s.assign(states.size(), -1);
+  if (nIn <= 0) return;
+  vector<int> idIn, idOut, idInLast, idOutLast;
+  set<int> sChannels;
+  PY8MEs_namespace::process_accessor proc_handle;
+  for (int iState = 0; iState < (int)states.size(); ++iState) {
+    const vector<Particle>& state = states[iState];
+    if ((int)state.size() <= nIn) continue;
+
+    // Access the process if the flavours differ from the last state.
+    idIn.clear();
+    idOut.clear();
+    for (int i = 0; i < (int)state.size(); ++i)
+      (i < nIn ? idIn : idOut).push_back(state[i].id());
+    if (idInLast.empty() || idIn != idInLast || idOut != idOutLast) {
+      proc_handle = libPtr->getProcess(
+        libPtr->getProcessSpecifier(idIn, idOut, sChannels));
+      idInLast  = idIn;
+      idOutLast = idOut;
+    }
+    if (proc_handle.second.second < 0) continue;
+    me2s[iState] = me2VinciaProcess(state, nIn, &proc_handle);
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
+// Get the matrix element squared for a particle state, for a given
+// process if procPtr is not null.
+
+double ShowerMEsMadgraph::me2VinciaProcess(const vector<Particle>& state,
+  int nIn, const PY8MEs_namespace::process_accessor* procPtr) {
 
   // Prepare vector of incoming ID codes.
   if (nIn <= 0) return -1;
@@ -189,11 +243,11 @@ double ShowerMEsMadgraph::me2Vincia(vector<Particle> state, int nIn) {
   // Currently not using the option to request specific s-channels.
   set<int> sChannels;
 
-  // Access the process.
-  PY8MEs_namespace::process_specifier proc_spec =
-    libPtr->getProcessSpecifier(idIn, idOut, sChannels);
-  PY8MEs_namespace::process_accessor proc_handle =
-    libPtr->getProcess(proc_spec);
+  // Access the process, unless already given.
+  PY8MEs_namespace::process_accessor proc_handle;
+  if (procPtr != nullptr) proc_handle = *procPtr;
+  else proc_handle = libPtr->getProcess(
+    libPtr->getProcessSpecifier(idIn, idOut, sChannels));
 
   // Return right away if unavailable.
   if (proc_handle.second.second < 0) return -1;
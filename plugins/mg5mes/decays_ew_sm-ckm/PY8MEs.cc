@@ -225,6 +225,13 @@ void PY8MEs::seProcessesIncludeColorAveragingFactors(bool OnOff)
     loaded_processes[i]->setIncludeColorAveragingFactors(OnOff); 
   }
 }
+void PY8MEs::setProcessesHelicityPruning(bool OnOff) 
+{
+  for (unsigned int i = 0; i < loaded_processes.size(); i++ )
+  {
+    loaded_processes[i]->setHelicityPruning(OnOff); 
+  }
+}
 
 //--------------------------------------------------------------------------
 // Function to initialize the model
@@ -167,6 +167,15 @@ class PY8MEs_R10_P9_sm_ckm_wp_lvl : public PY8ME
     }
     virtual int getColorAveragingFactor() {return denom_colors[proc_ID];}
 
+    // Control whether to skip helicities found to vanish in their first
+    // evaluations or not
+    virtual void setHelicityPruning(bool OnOff) 
+    {
+      helicity_pruning = OnOff; 
+      resetHelicityPruning(); 
+    }
+    virtual bool getHelicityPruning() {return helicity_pruning;}
+
   private:
 
     // Private functions to calculate the matrix element for all subprocesses
@@ -200,6 +209,18 @@ class PY8MEs_R10_P9_sm_ckm_wp_lvl : public PY8ME
     bool include_helicity_averaging_factors; 
     // Control whether to include color averaging factors or not
     bool include_color_averaging_factors; 
+    // Control whether to skip helicities found to vanish or not
+    bool helicity_pruning; 
+
+    // Helicities found to give a non-zero result, and number of evaluations
+    // of each helicity, for each proc_ID
+    vector < vec_bool > goodhel; 
+    vector < vec_int > ntry; 
+    void resetHelicityPruning() 
+    {
+      goodhel = vector < vec_bool > (nprocesses, vec_bool(ncomb, false)); 
+      ntry = vector < vec_int > (nprocesses, vec_int(ncomb, 0)); 
+    }
 
     // Color flows, used when selecting color
     vector < vec_double > jamp2; 
@@ -677,6 +677,8 @@ void PY8MEs_R2_P1_sm_ckm_z_bbx::initProc()
   include_symmetry_factors = true; 
   include_helicity_averaging_factors = true; 
   include_color_averaging_factors = true; 
+  helicity_pruning = false; 
+  resetHelicityPruning(); 
 
   // Initialize vectors.
   perm = vector<int> (nexternal, 0); 
@@ -728,6 +730,8 @@ void PY8MEs_R2_P1_sm_ckm_z_bbx::setMasses(vec_double external_masses)
   {
     mME[j] = external_masses[perm[j]]; 
   }
+  // Vanishing helicities may differ with the new masses
+  resetHelicityPruning(); 
 }
 
 //--------------------------------------------------------------------------
@@ -783,6 +787,8 @@ void PY8MEs_R2_P1_sm_ckm_z_bbx::setExternalMassesMode(int mode)
       mME[j] = -1.0; 
     }
   }
+  // Vanishing helicities may differ with the new masses
+  resetHelicityPruning(); 
 }
 
 //--------------------------------------------------------------------------
@@ -812,14 +818,9 @@ double PY8MEs_R2_P1_sm_ckm_z_bbx::sigmaKin()
 
   // Local variables and constants
   const int max_tries = 10; 
-  vector < vec_bool > goodhel(nprocesses, vec_bool(ncomb, false)); 
-  vec_int ntry(nprocesses, 0); 
   double t = 0.; 
   double result = 0.; 
 
-  if (ntry[proc_ID] <= max_tries)
-    ntry[proc_ID] = ntry[proc_ID] + 1; 
-
   // Find which helicity configuration is asked for
   // -1 indicates one wants to sum over helicities
   int user_ihel = getHelicityIDForConfig(user_helicities); 
@@ -849,12 +850,13 @@ double PY8MEs_R2_P1_sm_ckm_z_bbx::sigmaKin()
   // unless already detected as vanishing
   for(int ihel = 0; ihel < ncomb; ihel++ )
   {
-    // Skip helicity if already detected as vanishing
-    if ((ntry[proc_ID] >= max_tries) && !goodhel[proc_ID][ihel])
+    // Skip helicity if user asks for a specific one
+    if (user_ihel != -1 && user_ihel != ihel)
       continue; 
 
-    // Also skip helicity if user asks for a specific one
-    if ((ntry[proc_ID] >= max_tries) && user_ihel != -1 && user_ihel != ihel)
+    // Also skip helicity if already detected as vanishing
+    if (helicity_pruning && (ntry[proc_ID][ihel] >= max_tries) && 
+    !goodhel[proc_ID][ihel])
       continue; 
 
     calculate_wavefunctions(helicities[ihel]); 
@@ -867,7 +869,9 @@ double PY8MEs_R2_P1_sm_ckm_z_bbx::sigmaKin()
       t = matrix_2_z_bbx(); 
 
     // Store which helicities give non-zero result
-    if ((ntry[proc_ID] < max_tries) && t != 0. && !goodhel[proc_ID][ihel])
+    if (ntry[proc_ID][ihel] < max_tries)
+      ntry[proc_ID][ihel] = ntry[proc_ID][ihel] + 1; 
+    if (t != 0. && !goodhel[proc_ID][ihel])
       goodhel[proc_ID][ihel] = true; 
 
     // Aggregate results
@@ -113,6 +113,11 @@ class PY8ME
     virtual bool getIncludeColorAveragingFactors() = 0; 
     virtual int getColorAveragingFactor() = 0; 
 
+    // Control whether to skip helicities found to vanish in their first
+    // evaluations or not
+    virtual void setHelicityPruning(bool OnOff) = 0; 
+    virtual bool getHelicityPruning() = 0; 
+
 }; 
 
 }  // End namespace PY8MEs_namespace
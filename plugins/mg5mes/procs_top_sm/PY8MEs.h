@@ -228,6 +228,7 @@ class PY8MEs
     void seProcessesIncludeSymmetryFactors(bool OnOff); 
     void seProcessesIncludeHelicityAveragingFactors(bool OnOff); 
     void seProcessesIncludeColorAveragingFactors(bool OnOff); 
+    void setProcessesHelicityPruning(bool OnOff); 
 
   private:
 
@@ -0,0 +1,197 @@
+// pythia8_addons.h is a part of the PYTHIA event generator.
+// Copyright (C) 2021 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// Hand-written additions to the automatically generated Python interface.
+// They are attached to the generated classes with the Binder option
+// "+add_on_binder", see the generate script.
+// Event.to_numpy: a structured NumPy array that views the particles of
+//   the event record in place, without copying.
+// Pythia.next_batch: generate several events in C++, with the GIL
+//   released, and return the particles as NumPy columns.
+
+#ifndef Pythia8_pythia8_addons_H
+#define Pythia8_pythia8_addons_H
+
+#include <Pythia8/Pythia.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+
+//==========================================================================
+
+// Byte offset of a member within an object.
+
+template<typename T> inline int pythia8AddonOffset(const T* member,
+  const void* object) {
+  return int(reinterpret_cast<const char*>(member)
+    - reinterpret_cast<const char*>(object));
+}
+
+//--------------------------------------------------------------------------
+
+// The NumPy data type describing a Particle in memory. The Particle
+// members are public in the Python build, see the Makefile. The Vec4
+// components are checked to be stored in the order px, py, pz, e.
+
+inline pybind11::dtype pythia8ParticleDtype() {
+
+  // Check the Vec4 layout.
+  Pythia8::Vec4 v(1., 2., 3., 4.);
+  const double* d = reinterpret_cast<const double*>(&v);
+  if (sizeof(Pythia8::Vec4) != 4 * sizeof(double) || d[0] != 1.
+    || d[1] != 2. || d[2] != 3. || d[3] != 4.)
+    throw std::runtime_error("unexpected Vec4 memory layout");
+
+  // Integer and floating-point fields with their offsets.
+  Pythia8::Particle pt;
+  pybind11::list names, formats, offsets;
+  auto add = [&](const char* name, const char* format, int offset) {
+    names.append(name); formats.append(format); offsets.append(offset);};
+  add("id",        "i4", pythia8AddonOffset(&pt.idSave, &pt));
+  add("status",    "i4", pythia8AddonOffset(&pt.statusSave, &pt));
+  add("mother1",   "i4", pythia8AddonOffset(&pt.mother1Save, &pt));
+  add("mother2",   "i4", pythia8AddonOffset(&pt.mother2Save, &pt));
+  add("daughter1", "i4", pythia8AddonOffset(&pt.daughter1Save, &pt));
+  add("daughter2", "i4", pythia8AddonOffset(&pt.daughter2Save, &pt));
+  add("col",       "i4", pythia8AddonOffset(&pt.colSave, &pt));
+  add("acol",      "i4", pythia8AddonOffset(&pt.acolSave, &pt));
+  int offP = pythia8AddonOffset(&pt.pSave, &pt);
+  add("px",        "f8", offP);
+  add("py",        "f8", offP + 8);
+  add("pz",        "f8", offP + 16);
+  add("e",         "f8", offP + 24);
+  add("m",         "f8", pythia8AddonOffset(&pt.mSave, &pt));
+  add("scale",     "f8", pythia8AddonOffset(&pt.scaleSave, &pt));
+  add("pol",       "f8", pythia8AddonOffset(&pt.polSave, &pt));
+  int offV = pythia8AddonOffset(&pt.vProdSave, &pt);
+  add("xProd",     "f8", offV);
+  add("yProd",     "f8", offV + 8);
+  add("zProd",     "f8", offV + 16);
+  add("tProd",     "f8", offV + 24);
+  add("tau",       "f8", pythia8AddonOffset(&pt.tauSave, &pt));
+  return pybind11::dtype(names, formats, offsets, sizeof(Pythia8::Particle));
+
+}
+
+//--------------------------------------------------------------------------
+
+// Event.to_numpy(): a read-only view of the event record. The array keeps
+// the event alive, but becomes invalid when particles are added to or
+// removed from the event, e.g. by the next call to Pythia.next. It is
+// read-only since writing e.g. the id field directly would bypass
+// Particle::id(int), which also resets the particle data pointer.
+
+inline pybind11::array pythia8EventToNumpy(pybind11::object self) {
+
+  // The data type is never deleted, to be safe at interpreter exit.
+  static pybind11::dtype* dtPtr = new pybind11::dtype(pythia8ParticleDtype());
+  const pybind11::dtype& dt = *dtPtr;
+  Pythia8::Event& event = self.cast<Pythia8::Event&>();
+  if (event.size() == 0) return pybind11::array(dt, 0);
+  pybind11::array arr(dt, {event.size()},
+    {ssize_t(sizeof(Pythia8::Particle))}, &event[0], self);
+  arr.attr("setflags")(pybind11::arg("write") = false);
+  return arr;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Attach the additions to the Event class.
+
+template<typename Class> void bind_Pythia8_Event_addons(Class& cl) {
+  cl.def("to_numpy", &pythia8EventToNumpy, "Structured NumPy array viewing "
+    "the particles of the event record, without copying. Read-only, and "
+    "only valid until the event record is changed.");
+}
+
+//==========================================================================
+
+// Pythia.next_batch(nEvent, finalOnly = True, callback = None): generate
+// nEvent events and return a dictionary of NumPy arrays, with one entry
+// per particle (only final ones by default) for the batch event number
+// and the particle properties, and one entry per event for the weights.
+// Without a callback the GIL is released for the whole batch. Otherwise
+// it is only released during event generation, and the callback is then
+// called with the event record; events for which it returns False are
+// not stored.
+
+inline pybind11::dict pythia8NextBatch(Pythia8::Pythia& pythia, int nEvent,
+  bool finalOnly, pybind11::object callback) {
+
+  // Columns to be filled.
+  std::vector<int>    iEvt, id, status;
+  std::vector<double> px, py, pz, e, m, weight;
+  int nFail = 0;
+
+  // Store the current event, if accepted.
+  auto store = [&]() {
+    const Pythia8::Event& event = pythia.event;
+    int iNow = int(weight.size());
+    for (int i = 0; i < event.size(); ++i) {
+      const Pythia8::Particle& pt = event[i];
+      if (finalOnly && !pt.isFinal()) continue;
+      iEvt.push_back(iNow);
+      id.push_back(pt.id());
+      status.push_back(pt.status());
+      px.push_back(pt.px());
+      py.push_back(pt.py());
+      pz.push_back(pt.pz());
+      e.push_back(pt.e());
+      m.push_back(pt.m());
+    }
+    weight.push_back(pythia.info.weight());
+  };
+
+  // Event loop, with the GIL released where possible.
+  if (callback.is_none()) {
+    pybind11::gil_scoped_release release;
+    for (int iEvent = 0; iEvent < nEvent; ++iEvent) {
+      if (!pythia.next()) { ++nFail; continue; }
+      store();
+    }
+  } else {
+    for (int iEvent = 0; iEvent < nEvent; ++iEvent) {
+      bool ok;
+      {
+        pybind11::gil_scoped_release release;
+        ok = pythia.next();
+      }
+      if (!ok) { ++nFail; continue; }
+      if (!callback(pybind11::cast(&pythia.event,
+        pybind11::return_value_policy::reference)).cast<bool>()) continue;
+      store();
+    }
+  }
+
+  // Copy the columns to NumPy arrays.
+  pybind11::dict batch;
+  batch["event"]  = pybind11::array_t<int>(iEvt.size(), iEvt.data());
+  batch["id"]     = pybind11::array_t<int>(id.size(), id.data());
+  batch["status"] = pybind11::array_t<int>(status.size(), status.data());
+  batch["px"]     = pybind11::array_t<double>(px.size(), px.data());
+  batch["py"]     = pybind11::array_t<double>(py.size(), py.data());
+  batch["pz"]     = pybind11::array_t<double>(pz.size(), pz.data());
+  batch["e"]      = pybind11::array_t<double>(e.size(), e.data());
+  batch["m"]      = pybind11::array_t<double>(m.size(), m.data());
+  batch["weight"] = pybind11::array_t<double>(weight.size(), weight.data());
+  batch["nFail"]  = nFail;
+  return batch;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Attach the additions to the Pythia class.
+
+template<typename Class> void bind_Pythia8_Pythia_addons(Class& cl) {
+  cl.def("next_batch", &pythia8NextBatch, "Generate several events with "
+    "the GIL released, and return the particles as NumPy columns.",
+    pybind11::arg("nEvent"), pybind11::arg("finalOnly") = true,
+    pybind11::arg("callback") = pybind11::none());
+}
+
+//==========================================================================
+
+#endif // Pythia8_pythia8_addons_H
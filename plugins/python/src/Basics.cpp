@@ -15,6 +15,7 @@
 #include <Pythia8/BeamShape.h>
 #include <pybind11/stl.h>
 #include <pybind11/complex.h>
+#include <pythia8_addons.h>
 
 
 #ifndef BINDER_PYBIND11_TYPE_CASTER
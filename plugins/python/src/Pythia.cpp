@@ -50,6 +50,7 @@
 #include <Pythia8/BeamShape.h>
 #include <pybind11/stl.h>
 #include <pybind11/complex.h>
+#include <pythia8_addons.h>
 
 
 #ifndef BINDER_PYBIND11_TYPE_CASTER
@@ -137,10 +138,10 @@ void bind_Pythia8_Pythia(std::function< pybind11::module &(std::string const &na
 		cl.def("getShowerModelPtr", (class std::shared_ptr<class Pythia8::ShowerModel> (Pythia8::Pythia::*)()) &Pythia8::Pythia::getShowerModelPtr, "C++: Pythia8::Pythia::getShowerModelPtr() --> class std::shared_ptr<class Pythia8::ShowerModel>");
 		cl.def("setPartonVertexPtr", (bool (Pythia8::Pythia::*)(class std::shared_ptr<class Pythia8::PartonVertex>)) &Pythia8::Pythia::setPartonVertexPtr, "C++: Pythia8::Pythia::setPartonVertexPtr(class std::shared_ptr<class Pythia8::PartonVertex>) --> bool", pybind11::arg("partonVertexPtrIn"));
 		cl.def("init", (bool (Pythia8::Pythia::*)()) &Pythia8::Pythia::init, "C++: Pythia8::Pythia::init() --> bool");
-		cl.def("next", (bool (Pythia8::Pythia::*)()) &Pythia8::Pythia::next, "C++: Pythia8::Pythia::next() --> bool");
-		cl.def("next", (bool (Pythia8::Pythia::*)(double)) &Pythia8::Pythia::next, "C++: Pythia8::Pythia::next(double) --> bool", pybind11::arg("eCMin"));
-		cl.def("next", (bool (Pythia8::Pythia::*)(double, double)) &Pythia8::Pythia::next, "C++: Pythia8::Pythia::next(double, double) --> bool", pybind11::arg("eAin"), pybind11::arg("eBin"));
-		cl.def("next", (bool (Pythia8::Pythia::*)(double, double, double, double, double, double)) &Pythia8::Pythia::next, "C++: Pythia8::Pythia::next(double, double, double, double, double, double) --> bool", pybind11::arg("pxAin"), pybind11::arg("pyAin"), pybind11::arg("pzAin"), pybind11::arg("pxBin"), pybind11::arg("pyBin"), pybind11::arg("pzBin"));
+		cl.def("next", (bool (Pythia8::Pythia::*)()) &Pythia8::Pythia::next, "C++: Pythia8::Pythia::next() --> bool", pybind11::call_guard<pybind11::gil_scoped_release>());
+		cl.def("next", (bool (Pythia8::Pythia::*)(double)) &Pythia8::Pythia::next, "C++: Pythia8::Pythia::next(double) --> bool", pybind11::call_guard<pybind11::gil_scoped_release>(), pybind11::arg("eCMin"));
+		cl.def("next", (bool (Pythia8::Pythia::*)(double, double)) &Pythia8::Pythia::next, "C++: Pythia8::Pythia::next(double, double) --> bool", pybind11::call_guard<pybind11::gil_scoped_release>(), pybind11::arg("eAin"), pybind11::arg("eBin"));
+		cl.def("next", (bool (Pythia8::Pythia::*)(double, double, double, double, double, double)) &Pythia8::Pythia::next, "C++: Pythia8::Pythia::next(double, double, double, double, double, double) --> bool", pybind11::call_guard<pybind11::gil_scoped_release>(), pybind11::arg("pxAin"), pybind11::arg("pyAin"), pybind11::arg("pzAin"), pybind11::arg("pxBin"), pybind11::arg("pyBin"), pybind11::arg("pzBin"));
 		cl.def("forceTimeShower", [](Pythia8::Pythia &o, int const & a0, int const & a1, double const & a2) -> int { return o.forceTimeShower(a0, a1, a2); }, "", pybind11::arg("iBeg"), pybind11::arg("iEnd"), pybind11::arg("pTmax"));
 		cl.def("forceTimeShower", (int (Pythia8::Pythia::*)(int, int, double, int)) &Pythia8::Pythia::forceTimeShower, "C++: Pythia8::Pythia::forceTimeShower(int, int, double, int) --> int", pybind11::arg("iBeg"), pybind11::arg("iEnd"), pybind11::arg("pTmax"), pybind11::arg("nBranchMax"));
 		cl.def("forceHadronLevel", [](Pythia8::Pythia &o) -> bool { return o.forceHadronLevel(); }, "");
@@ -168,5 +169,7 @@ void bind_Pythia8_Pythia(std::function< pybind11::module &(std::string const &na
 		cl.def("getPDFPtr", [](Pythia8::Pythia &o, int const & a0, int const & a1, class std::basic_string<char> const & a2) -> std::shared_ptr<class Pythia8::PDF> { return o.getPDFPtr(a0, a1, a2); }, "", pybind11::arg("idIn"), pybind11::arg("sequence"), pybind11::arg("beam"));
 		cl.def("getPDFPtr", (class std::shared_ptr<class Pythia8::PDF> (Pythia8::Pythia::*)(int, int, std::string, bool)) &Pythia8::Pythia::getPDFPtr, "C++: Pythia8::Pythia::getPDFPtr(int, int, std::string, bool) --> class std::shared_ptr<class Pythia8::PDF>", pybind11::arg("idIn"), pybind11::arg("sequence"), pybind11::arg("beam"), pybind11::arg("resolved"));
 		cl.def("infoPython", (class Pythia8::Info (Pythia8::Pythia::*)()) &Pythia8::Pythia::infoPython, "C++: Pythia8::Pythia::infoPython() --> class Pythia8::Info");
+
+		bind_Pythia8_Pythia_addons(cl);
 	}
 }
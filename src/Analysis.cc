@@ -971,6 +971,8 @@ bool SlowJet::setup(const Event& event) {
   clLast = clSize - 1;
   diB.resize(clSize);
   dij.resize(clSize * (clSize - 1) / 2);
+  dNN.resize(clSize);
+  jNN.resize(clSize);
 
   // Loop through particles and find distance to beams.
   for (int i = 0; i < clSize; ++i) {
@@ -988,9 +990,12 @@ bool SlowJet::setup(const Event& event) {
       if (isAnti)    dijTemp /= max(clusters[i].pT2, clusters[j].pT2);
       else if (isKT) dijTemp *= min(clusters[i].pT2, clusters[j].pT2);
       dij[i*(i-1)/2 + j] = dijTemp;
-
-    // End of original-particle loops.
     }
+
+    // Nearest neighbour among the earlier particles.
+    findNN(i);
+
+  // End of original-particle loop.
   }
 
   // Find first particle pair to join.
@@ -1075,6 +1080,18 @@ bool SlowJet::doStep() {
   --clSize;
   --clLast;
 
+  // Update the nearest neighbours. Only the distances in positions jMin
+  // and iMin have changed, so other clusters need to be rescanned only
+  // if their nearest neighbour was in one of these positions.
+  for (int i = 0; i < clSize; ++i) {
+    if (i == jMin || i == iMin || jNN[i] == iMin
+      || (jMin >= 0 && jNN[i] == jMin)) findNN(i);
+    else {
+      if (jMin >= 0 && jMin < i) updateNN(i, jMin);
+      if (iMin < i) updateNN(i, iMin);
+    }
+  }
+
   // Find next cluster pair to join.
   findNext();
 
@@ -1143,12 +1160,10 @@ void SlowJet::findNext() {
         jMin = -1;
         dMin = diB[i];
       }
-      for (int j = 0; j < i; ++j) {
-        if (dij[i*(i-1)/2 + j] < dMin) {
-          iMin = i;
-          jMin = j;
-          dMin = dij[i*(i-1)/2 + j];
-        }
+      if (dNN[i] < dMin) {
+        iMin = i;
+        jMin = jNN[i];
+        dMin = dNN[i];
       }
     }
 
@@ -1163,6 +1178,25 @@ void SlowJet::findNext() {
 
 //--------------------------------------------------------------------------
 
+// Find the nearest neighbour of cluster i among clusters j < i. The
+// first one is kept for equal distances, so that findNext makes the
+// same choice as a scan through all the pairs.
+
+void SlowJet::findNN(int i) {
+
+  dNN[i] = numeric_limits<double>::infinity();
+  jNN[i] = -1;
+  for (int j = 0; j < i; ++j) {
+    if (dij[i*(i-1)/2 + j] < dNN[i]) {
+      dNN[i] = dij[i*(i-1)/2 + j];
+      jNN[i] = j;
+    }
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
 // Use FJcore interface to perform clustering.
 
 bool SlowJet::clusterFJ() {
@@ -980,6 +980,9 @@ const int    Hist::NCOLMAX   = 100;
 // Maximum number of lines a histogram can use at output.
 const int    Hist::NLINES    = 30;
 
+// Number of values for which bins are found together in a batch fill.
+const int    Hist::NBATCH    = 64;
+
 // Tolerance in deviation of xMin and xMax between two histograms.
 const double Hist::TOLERANCE = 0.001;
 
@@ -1088,6 +1091,56 @@ void Hist::fill(double x, double w) {
 
 //--------------------------------------------------------------------------
 
+// Fill several values at once. The bins are first found for a block of
+// values, in a loop without branches for a linear scale, and the weights
+// are then added in the same order as by single fills, so the result is
+// identical. Inside the histogram range truncation equals floor.
+
+void Hist::fillBatch(const double* x, const double* w, double wAll,
+  int n) {
+
+  int iBins[NBATCH];
+  for (int iBeg = 0; iBeg < n; iBeg += NBATCH) {
+    int nNow = min( NBATCH, n - iBeg);
+    const double* xNow = x + iBeg;
+
+    // Find bins, with -1 for underflow and nBin for overflow. Full
+    // blocks have a fixed length, to help the compiler vectorize.
+    if (linX) {
+      auto findBin = [&](int i) {
+        double xBin = max( 0., min( (xNow[i] - xMin) / dx, double(nBin)));
+        int iBin = (xNow[i] > xMax) ? nBin : int(xBin);
+        iBins[i] = (xNow[i] < xMin) ? -1 : iBin; };
+      if (nNow == NBATCH) for (int i = 0; i < NBATCH; ++i) findBin(i);
+      else for (int i = 0; i < nNow; ++i) findBin(i);
+    } else for (int i = 0; i < nNow; ++i) {
+      // Non-finite values are skipped below; NaN must not reach the int
+      // conversion.
+      if      (!isfinite(xNow[i])) iBins[i] = -1;
+      else if (xNow[i] < xMin) iBins[i] = -1;
+      else if (xNow[i] > xMax) iBins[i] = nBin;
+      else iBins[i] = int( min( log10(xNow[i] / xMin) / dx, double(nBin)));
+    }
+
+    // Add the weights.
+    for (int i = 0; i < nNow; ++i) {
+      double wNow = (w == 0) ? wAll : w[iBeg + i];
+      if (!isfinite(xNow[i]) || !isfinite(wNow)) {nNonFinite += 1; continue;}
+      ++nFill;
+      if      (iBins[i] < 0)     under += wNow;
+      else if (iBins[i] >= nBin) over  += wNow;
+      else {
+        res[iBins[i]] += wNow;
+        inside        += wNow;
+        sumxw         += xNow[i] * wNow;
+      }
+    }
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
 // Print a histogram: also operator overloading with friend.
 
 ostream& operator<<(ostream& os, const Hist& h) {
@@ -1472,6 +1525,7 @@ void Hist::normalizeSpectrum(double wtSum) {
 Hist& Hist::operator+=(const Hist& h) {
   if (!sameSize(h)) return *this;
   nFill  += h.nFill;
+  nNonFinite += h.nNonFinite;
   under  += h.under;
   inside += h.inside;
   over   += h.over;
@@ -1640,6 +1694,65 @@ Hist operator/(double f, const Hist& h1) {
 
 //==========================================================================
 
+// SharedHist class.
+// A histogram that can be filled from several threads at the same time.
+
+//--------------------------------------------------------------------------
+
+// Counter to give each histogram its own identifier.
+
+atomic<long long> SharedHist::nextId(0);
+
+//--------------------------------------------------------------------------
+
+// Sum of the histograms of all threads.
+
+Hist SharedHist::result() const {
+
+  lock_guard<mutex> lock(mtx);
+  Hist sum(histSave);
+  for (const Hist& h : shards) sum += h;
+  return sum;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Reset bin contents, in all threads.
+
+void SharedHist::null() {
+
+  lock_guard<mutex> lock(mtx);
+  histSave.null();
+  for (Hist& h : shards) h.null();
+
+}
+
+//--------------------------------------------------------------------------
+
+// Find the histogram of the current thread, or create it. Each thread
+// keeps a map from histogram identifier to its own histogram, so that
+// the lock is only needed the first time. Entries are not removed when
+// a histogram is destroyed, but since identifiers are never reused they
+// are not found again.
+
+Hist& SharedHist::shard() {
+
+  static thread_local unordered_map<long long, Hist*> shardMap;
+  unordered_map<long long, Hist*>::iterator iter = shardMap.find(idSave);
+  if (iter != shardMap.end()) return *iter->second;
+
+  // New empty histogram with the same binning.
+  lock_guard<mutex> lock(mtx);
+  shards.push_back( Hist( histSave.getTitle(), histSave.getBinNumber(),
+    histSave.getXMin(), histSave.getXMax(), !histSave.getLinX()) );
+  shardMap[idSave] = &shards.back();
+  return shards.back();
+
+}
+
+//==========================================================================
+
 // HistPlot class.
 // Writes a Python program that can generate PDF plots from Hist histograms.
 
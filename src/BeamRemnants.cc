@@ -131,11 +131,12 @@ bool BeamRemnants::add( Event& event, int iFirst, bool doDiffCR) {
   nSys    = partonSystemsPtr->sizeSys();
   oldSize = event.size();
 
-  // Store event as it was before adding anything.
-  Event eventSave = event;
-  BeamParticle beamAsave = (*beamAPtr);
-  BeamParticle beamBsave = (*beamBPtr);
-  PartonSystems partonSystemsSave = (*partonSystemsPtr);
+  // Store event as it was before adding anything. The saved copies
+  // are kept between events, so that their memory can be reused.
+  event.saveCheckpoint( eventSave);
+  beamAsave         = (*beamAPtr);
+  beamBsave         = (*beamBPtr);
+  partonSystemsSave = (*partonSystemsPtr);
 
   // Two different methods to add the beam remnants.
   if (remnantMode == 0) {
@@ -144,17 +145,18 @@ bool BeamRemnants::add( Event& event, int iFirst, bool doDiffCR) {
     if (!addNew(event)) return false;
   if (isDIS) return true;
 
-  // Store event before doing colour reconnections.
-  Event eventTmpSave = event;
+  // Store event before doing colour reconnections, if any.
+  bool doCRnow = doReconnect && doDiffCR
+    && (reconnectMode == 1 || reconnectMode == 2);
+  if (doCRnow) event.saveCheckpoint( eventTmpSave);
   bool colCorrect = false;
   for (int i = 0; i < 10; ++i) {
-    if (doReconnect && doDiffCR
-    && (reconnectMode == 1 || reconnectMode == 2)) {
+    if (doCRnow) {
       colourReconnectionPtr->next(event, iFirst);
 
       // Check that the new colour structure is physical.
       if (!junctionSplitting.checkColours(event))
-        event = eventTmpSave;
+        event.restoreCheckpoint( eventTmpSave);
       else {
         colCorrect = true;
         break;
@@ -180,10 +182,7 @@ bool BeamRemnants::add( Event& event, int iFirst, bool doDiffCR) {
 
   // Restore event and return false if colour reconnection failed.
   if (!colCorrect) {
-    event = eventSave;
-    (*beamAPtr) = beamAsave;
-    (*beamBPtr) = beamBsave;
-    (*partonSystemsPtr) = partonSystemsSave;
+    restoreSaved(event);
     infoPtr->errorMsg("Error in BeamRemnants::add: "
       "failed to find physical colour state after colour reconnection");
     return false;
@@ -270,11 +269,8 @@ bool BeamRemnants::addOld( Event& event) {
 
 bool BeamRemnants::addNew( Event& event) {
 
-   // Start by saving a copy of the event, if the beam remnant fails.
-  Event eventSave = event;
-  BeamParticle beamAsave = (*beamAPtr);
-  BeamParticle beamBsave = (*beamBPtr);
-  PartonSystems partonSystemsSave = (*partonSystemsPtr);
+  // A copy of the event, to restore if the beam remnant fails,
+  // was already saved by add() just before this call.
 
   // Do several tries in case an unphysical colour contruction is made.
   bool beamRemnantFound = false;
@@ -303,10 +299,7 @@ bool BeamRemnants::addNew( Event& event) {
     // Do the kinematics of the collision subsystems and two beam remnants.
     if (!setKinematics(event)) {
       // If it does not work, try parton level again.
-      event = eventSave;
-      (*beamAPtr) = beamAsave;
-      (*beamBPtr) = beamBsave;
-      (*partonSystemsPtr) = partonSystemsSave;
+      restoreSaved(event);
       return false;
     }
 
@@ -323,10 +316,7 @@ bool BeamRemnants::addNew( Event& event) {
     // If failed, restore earlier configuration and try to find new
     // colour structure.
     else {
-      event = eventSave;
-      (*beamAPtr) = beamAsave;
-      (*beamBPtr) = beamBsave;
-      (*partonSystemsPtr) = partonSystemsSave;
+      restoreSaved(event);
     }
   }
 
@@ -335,10 +325,7 @@ bool BeamRemnants::addNew( Event& event) {
     infoPtr->errorMsg("Error in BeamRemnants::addNew: "
         "failed to find physical colour structure");
     // Restore event to previous state.
-    event = eventSave;
-    (*beamAPtr) = beamAsave;
-    (*beamBPtr) = beamBsave;
-    (*partonSystemsPtr) = partonSystemsSave;
+    restoreSaved(event);
     return false;
   }
 
@@ -50,6 +50,9 @@ bool BoseEinstein::init() {
   lambda   = parm("BoseEinstein:lambda");
   QRef     = parm("BoseEinstein:QRef");
 
+  // Optional cut on the pair relative momentum, in units of QRef.
+  QMax     = parm("BoseEinstein:QMaxRel") * QRef;
+
   // Multiples and inverses (= "radii") of distance parameters in Q-space.
   QRef2    = 2. * QRef;
   QRef3    = 3. * QRef;
@@ -138,9 +141,14 @@ bool BoseEinstein::shiftEvent( Event& event) {
     nStored[iSpecies + 1] = hadronBE.size();
 
     // Loop through pairs of identical particles and find shifts.
-    for (int i1 = nStored[iSpecies]; i1 < nStored[iSpecies+1] - 1; ++i1)
-    for (int i2 = i1 + 1; i2 < nStored[iSpecies+1]; ++i2)
-      shiftPair( i1, i2, iTab);
+    if (QMax <= 0.) {
+      for (int i1 = nStored[iSpecies]; i1 < nStored[iSpecies+1] - 1; ++i1)
+      for (int i2 = i1 + 1; i2 < nStored[iSpecies+1]; ++i2)
+        shiftPair( i1, i2, iTab);
+    }
+
+    // Else only pairs closer than QMax, found in a rapidity sweep.
+    else shiftNearPairs( nStored[iSpecies], nStored[iSpecies+1], iTab);
   }
 
   // Must have at least two pairs to carry out compensation.
@@ -198,6 +206,51 @@ bool BoseEinstein::shiftEvent( Event& event) {
 
 //--------------------------------------------------------------------------
 
+// Calculate shifts only for pairs of the hadrons in the range [iBeg, iEnd)
+// with Q < QMax. For two particles of mass m, Q >= 2 m sinh(|y1 - y2|/2),
+// so with the hadrons ordered in rapidity only a window need be scanned.
+
+void BoseEinstein::shiftNearPairs( int iBeg, int iEnd, int iTab) {
+
+  // Order the hadrons in rapidity and find the smallest mass.
+  if (iEnd - iBeg < 2) return;
+  vector< pair<double,int> > yOrder;
+  yOrder.reserve(iEnd - iBeg);
+  double m2Min = hadronBE[iBeg].m2;
+  for (int i = iBeg; i < iEnd; ++i) {
+    yOrder.push_back( make_pair( hadronBE[i].p.rap(), i) );
+    m2Min = min( m2Min, hadronBE[i].m2);
+  }
+  sort( yOrder.begin(), yOrder.end() );
+
+  // Largest rapidity separation that can still give Q < QMax. The Q as
+  // defined here uses the tabulated pair mass, which need not be the
+  // mass of the current species, so correct for that.
+  double Q2Max  = QMax * QMax;
+  double dyMax  = numeric_limits<double>::max();
+  if (m2Min > 0.) {
+    double sh2Max = (Q2Max + m2Pair[iTab] - 4. * m2Min) / (4. * m2Min);
+    if (sh2Max <= 0.) return;
+    dyMax = 2. * asinh( sqrt(sh2Max) );
+  }
+
+  // Sweep through the window. The pairs are visited in rapidity order,
+  // not in the original order. This does not change the result, apart
+  // from rounding, since the shifts of all pairs are first accumulated
+  // in pShift and only applied afterwards.
+  for (int j1 = 0, nHad = yOrder.size(); j1 < nHad - 1; ++j1)
+  for (int j2 = j1 + 1; j2 < nHad; ++j2) {
+    if (yOrder[j2].first - yOrder[j1].first > dyMax) break;
+    int i1 = min( yOrder[j1].second, yOrder[j2].second);
+    int i2 = max( yOrder[j1].second, yOrder[j2].second);
+    if (m2(hadronBE[i1].p, hadronBE[i2].p) - m2Pair[iTab] < Q2Max)
+      shiftPair( i1, i2, iTab);
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
 // Calculate shift and (unnormalized) compensation for pair.
 
 void BoseEinstein::shiftPair( int i1, int i2, int iTab) {
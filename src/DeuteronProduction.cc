@@ -50,6 +50,7 @@ bool DeuteronProduction::init() {
   kMax    = parm("DeuteronProduction:kMax");
   kTol    = parm("DeuteronProduction:kTol");
   kSteps  = mode("DeuteronProduction:kSteps");
+  double kCutIn = parm("DeuteronProduction:kCut");
 
   // Check the configuration vectors.
   string pre("Error in DeuteronProduction::init: ");
@@ -95,6 +96,19 @@ bool DeuteronProduction::init() {
   if (!valid) return valid;
   mPion = particleDataPtr->m0(211);
 
+  // Find the largest k at which any channel can bind, if there is one.
+  // The step function vanishes above its first parameter, while the
+  // other models are only cut if requested.
+  kCut = 0.;
+  for (int chn = 0; chn < int(parms.size()); ++chn) {
+    double kChn = (models[chn] == 0) ? parms[chn][0] : kCutIn;
+    if (kChn <= 0. && models[chn] != 0) {
+      kCut = 0.;
+      break;
+    }
+    kCut = max(kCut, kChn);
+  }
+
   // Find channel maxima and set the normalization.
   if (verbose)
     cout << "\n *----------  PYTHIA Deuteron Production "
@@ -195,10 +209,7 @@ void DeuteronProduction::bind(Event& event, vector<int>& prts) {
     if (prt0.status() < 0 || prt1.status() < 0) continue;
 
     // Calculate the momentum difference.
-    Vec4 p0(prt0.p()), p1(prt1.p()), p(p0 + p1);
-    p0.bstback(p);
-    p1.bstback(p);
-    double k((p0 - p1).pAbs());
+    double k(kRel(prt0.p(), prt1.p()));
 
     // Try binding each channel.
     double sum(0);
@@ -233,10 +244,41 @@ void DeuteronProduction::combos(Event& event, vector<int>& prts,
   vector<pair<int, int> >& cmbs) {
 
   // Create the combos.
-  for (int idx0 = 0; idx0 < int(prts.size()); ++idx0) {
-    int prt0(prts[idx0]), id(event[prt0].idAbs() == 2112);
-    for (int idx1 = idx0 + 1; idx1 < int(prts.size()); ++idx1) {
-      int prt1(prts[idx1]);
+  if (kCut <= 0.) {
+    for (int idx0 = 0; idx0 < int(prts.size()); ++idx0) {
+      int prt0(prts[idx0]), id(event[prt0].idAbs() == 2112);
+      for (int idx1 = idx0 + 1; idx1 < int(prts.size()); ++idx1) {
+        int prt1(prts[idx1]);
+        cmbs.push_back(make_pair(id ? prt1 : prt0, id ? prt0 : prt1));
+      }
+    }
+
+  // With a cut only keep pairs that can bind. Two nucleons with masses
+  // m0 and m1 have k >= 2 mMin r sinh(|y0 - y1|/2), r = 2 sqrt(m0 m1)
+  // / (m0 + m1), so only a rapidity window needs to be scanned.
+  } else if (prts.size() > 1) {
+    vector<pair<double, int> > yOrder;
+    double mMin(event[prts[0]].m()), mMax(mMin);
+    for (int idx = 0; idx < int(prts.size()); ++idx) {
+      Particle &prt = event[prts[idx]];
+      yOrder.push_back(make_pair(prt.y(), idx));
+      mMin = min(mMin, prt.m());
+      mMax = max(mMax, prt.m());
+    }
+    sort(yOrder.begin(), yOrder.end());
+    double dyMax(numeric_limits<double>::max());
+    if (mMin > 0) {
+      double r(2*sqrt(mMin*mMax)/(mMin + mMax));
+      dyMax = 2*asinh(kCut/(2*mMin*r));
+    }
+    for (int iy0 = 0; iy0 < int(yOrder.size()); ++iy0)
+    for (int iy1 = iy0 + 1; iy1 < int(yOrder.size()); ++iy1) {
+      if (yOrder[iy1].first - yOrder[iy0].first > dyMax) break;
+      int idx0(min(yOrder[iy0].second, yOrder[iy1].second));
+      int idx1(max(yOrder[iy0].second, yOrder[iy1].second));
+      int prt0(prts[idx0]), prt1(prts[idx1]);
+      if (kRel(event[prt0].p(), event[prt1].p()) >= kCut) continue;
+      int id(event[prt0].idAbs() == 2112);
       cmbs.push_back(make_pair(id ? prt1 : prt0, id ? prt0 : prt1));
     }
   }
@@ -248,6 +290,19 @@ void DeuteronProduction::combos(Event& event, vector<int>& prts,
 
 //--------------------------------------------------------------------------
 
+// Relative momentum of a nucleon pair in its rest frame.
+
+double DeuteronProduction::kRel(Vec4 p0, Vec4 p1) {
+
+  Vec4 p(p0 + p1);
+  p0.bstback(p);
+  p1.bstback(p);
+  return (p0 - p1).pAbs();
+
+}
+
+//--------------------------------------------------------------------------
+
 // Single pion final state fit, equations 10/13/14 of arXiv:1504.07242.
 
 double DeuteronProduction::fit(double k, vector<double>& c, int i) {
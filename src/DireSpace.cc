@@ -262,9 +262,11 @@ void DireSpace::init( BeamParticle* beamAPtrIn,
   doVariations = settingsPtr->flag("Variations:doVariations");
   splittingSelName="";
   splittingNowName="";
+  splittingNow = nullptr;
 
   // Set splitting library, if already exists.
   if (splittingsPtr) splits = splittingsPtr->getSplittings();
+  setSplittingDispatch();
   overhead.clear();
   for ( unordered_map<string,DireSplitting*>::iterator it = splits.begin();
     it != splits.end(); ++it ) overhead.insert(make_pair(it->first,1.));
@@ -432,6 +434,7 @@ void DireSpace::prepare( int iSys, Event& event, bool limitPTmaxIn) {
 
   // Set splitting library.
   splits = splittingsPtr->getSplittings();
+  setSplittingDispatch();
   overhead.clear();
   for ( unordered_map<string,DireSplitting*>::iterator it = splits.begin();
     it != splits.end(); ++it ) overhead.insert(make_pair(it->first,1.));
@@ -491,6 +494,7 @@ void DireSpace::prepare( int iSys, Event& event, bool limitPTmaxIn) {
 
   splittingSelName="";
   splittingNowName="";
+  splittingNow = nullptr;
   dipEndSel = 0;
 
   // Clear weighted shower book-keeping.
@@ -513,6 +517,7 @@ void DireSpace::clear() {
 
   splittingSelName="";
   splittingNowName="";
+  splittingNow = nullptr;
 
   // Clear weighted shower book-keeping.
   for ( unordered_map<string, multimap<double,double> >::iterator
@@ -911,6 +916,30 @@ bool DireSpace::updateAllowedEmissions(const Event& state, DireSpaceEnd* dip) {
 
 //--------------------------------------------------------------------------
 
+// Fill the dispatch table of splitting kernels. The kernels keep the
+// order of the splitting library, so that results do not change.
+
+void DireSpace::setSplittingDispatch() {
+
+  splitList.clear();
+  splitNames.clear();
+  splitDispatch[0].clear();
+  splitDispatch[1].clear();
+  for ( unordered_map<string,DireSplitting*>::iterator it = splits.begin();
+    it != splits.end(); ++it ) {
+    int iSplit = splitList.size();
+    splitList.push_back(it->second);
+    splitNames.push_back(it->first);
+    // FSR kernels only act on final-state, ISR kernels only on initial-state
+    // radiators.
+    if (!it->second->is_fsr) splitDispatch[0].push_back(iSplit);
+    if (!it->second->is_isr) splitDispatch[1].push_back(iSplit);
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
 // Function to set up and append a new dipole.
 
 bool DireSpace::appendAllowedEmissions(const Event& state, DireSpaceEnd* dip) {
@@ -922,51 +951,52 @@ bool DireSpace::appendAllowedEmissions(const Event& state, DireSpaceEnd* dip) {
   pair<int,int> iRadRec(make_pair(iRad, iRecNow));
   pair<int,int> iRecRad(make_pair(iRecNow, iRad));
 
-  for ( unordered_map<string,DireSplitting*>::iterator it = splits.begin();
-    it != splits.end(); ++it ) {
+  const vector<int>& splitsRad = splitDispatch[state[iRad].isFinal()];
+  const vector<int>& splitsRec = splitDispatch[state[iRecNow].isFinal()];
+  for (int iSplit : splitsRad) {
+    DireSplitting* split = splitList[iSplit];
 
     // Check if splitting is allowed.
-    bool allowed = it->second->useFastFunctions()
-                 ? it->second->canRadiate(state,iRad,iRecNow)
-                 : it->second->canRadiate(state,iRadRec,bool_settings);
+    bool allowed = split->useFastFunctions()
+                 ? split->canRadiate(state,iRad,iRecNow)
+                 : split->canRadiate(state,iRadRec,bool_settings);
     if (!allowed) continue;
 
     // Get emission id.
-    vector<int> re = it->second->radAndEmt( state[iRad].id(), dip->colType);
+    vector<int> re = split->radAndEmt( state[iRad].id(), dip->colType);
 
     for (int iEmtAft=1; iEmtAft < int(re.size()); ++iEmtAft) {
       int idEmtAft = re[iEmtAft];
-      if (it->second->is_qcd) {
+      if (split->is_qcd) {
         idEmtAft = abs(idEmtAft);
         if (idEmtAft<10) idEmtAft = 1;
       }
 
-      if (!it->second->isPartial()) {
+      if (!split->isPartial()) {
         dip->appendAllowedEmt(idEmtAft);
         isAllowed = true;
       } else {
 
         // Now check that emission also allowed when radiating from recoiler.
         bool isPartialFractioned = false;
-        for ( unordered_map<string,DireSplitting*>::iterator itRec =
-                splits.begin();
-          itRec != splits.end(); ++itRec ) {
+        for (int iSplitRec : splitsRec) {
+          DireSplitting* splitRec = splitList[iSplitRec];
 
           if ( isPartialFractioned ) break;
-          bool allowedRec = itRec->second->useFastFunctions()
-                 ? itRec->second->canRadiate(state,iRecNow,iRad)
-                 : itRec->second->canRadiate(state,iRecRad,bool_settings);
+          bool allowedRec = splitRec->useFastFunctions()
+                 ? splitRec->canRadiate(state,iRecNow,iRad)
+                 : splitRec->canRadiate(state,iRecRad,bool_settings);
           if (!allowedRec) continue;
 
           // Get emission id.
           int colTypeRec
             = state[iRecNow].isFinal() ? -dip->colType : dip->colType;
           vector<int> reRec
-            = itRec->second->radAndEmt( state[iRecNow].id(), colTypeRec);
+            = splitRec->radAndEmt( state[iRecNow].id(), colTypeRec);
 
           for (int iEmtAftRec=1; iEmtAftRec<int(reRec.size()); ++iEmtAftRec) {
             int idEmtAftRec = reRec[iEmtAftRec];
-            if (itRec->second->is_qcd) {
+            if (splitRec->is_qcd) {
               idEmtAftRec = abs(idEmtAftRec);
               if (idEmtAftRec<10) idEmtAftRec = 1;
             }
@@ -1052,6 +1082,7 @@ double DireSpace::newPoint(const Event& inevt) {
   iSysSel       = 0;
   dipEndSel     = 0;
   splittingNowName="";
+  splittingNow = nullptr;
   splittingSelName="";
   for ( unordered_map<string,DireSplitting*>::iterator it = splits.begin();
     it != splits.end(); ++it ) it->second->splitInfo.clear();
@@ -1182,6 +1213,7 @@ double DireSpace::pTnext( Event& event, double pTbegAll, double pTendAll,
   iSysSel       = 0;
   dipEndSel     = 0;
   splittingNowName="";
+  splittingNow = nullptr;
   splittingSelName="";
   for ( unordered_map<string,DireSplitting*>::iterator it = splits.begin();
     it != splits.end(); ++it ) it->second->splitInfo.clear();
@@ -1323,6 +1355,7 @@ double DireSpace::noEmissionProbability( double pTbegAll, double pTendAll,
 
   // Starting values: no radiating dipole found.
   splittingNowName="";
+  splittingNow = nullptr;
   splittingSelName="";
   for ( unordered_map<string,DireSplitting*>::iterator it = splits.begin();
     it != splits.end(); ++it ) it->second->splitInfo.clear();
@@ -1474,6 +1507,7 @@ double DireSpace::pTnext( vector<DireSpaceEnd> dipEnds, Event event,
   iSysSel       = 0;
   dipEndSel     = 0;
   splittingNowName="";
+  splittingNow = nullptr;
   splittingSelName="";
   for ( unordered_map<string,DireSplitting*>::iterator it = splits.begin();
     it != splits.end(); ++it ) it->second->splitInfo.clear();
@@ -1486,6 +1520,7 @@ double DireSpace::pTnext( vector<DireSpaceEnd> dipEnds, Event event,
 
   // Set splitting library.
   splits = splittingsPtr->getSplittings();
+  setSplittingDispatch();
   overhead.clear();
   for ( unordered_map<string,DireSplitting*>::iterator it = splits.begin();
     it != splits.end(); ++it ) overhead.insert(make_pair(it->first,1.));
@@ -1497,6 +1532,7 @@ double DireSpace::pTnext( vector<DireSpaceEnd> dipEnds, Event event,
 
   splittingSelName="";
   splittingNowName="";
+  splittingNow = nullptr;
   dipEndSel = 0;
 
   // Clear weighted shower book-keeping.
@@ -1598,7 +1634,7 @@ double DireSpace::pTnext( vector<DireSpaceEnd> dipEnds, Event event,
 
 //--------------------------------------------------------------------------
 
-double DireSpace::enhanceOverestimateFurther( string name, int,
+double DireSpace::enhanceOverestimateFurther( const string& name, int,
   double tOld) {
 
   if (tOld < pT2minEnhance) return 1.;
@@ -1609,8 +1645,8 @@ double DireSpace::enhanceOverestimateFurther( string name, int,
 
 //--------------------------------------------------------------------------
 
-double DireSpace::overheadFactors( string name, int idDau, bool isValence,
-  double m2dip, double pT2Old ) {
+double DireSpace::overheadFactors( const string& name, int idDau,
+  bool isValence, double m2dip, double pT2Old ) {
 
   double factor = 1.;
 
@@ -1669,28 +1705,33 @@ void DireSpace::getNewOverestimates( int idDau, DireSpaceEnd* dip,
 
   double sum=0.;
 
-  // Loop over splitting names and get overestimates.
-  for ( unordered_map<string,DireSplitting*>::iterator it = splits.begin();
-    it != splits.end(); ++it ) {
+  // Number of final-state particles, for the kernel overhead.
+  int nFinal = 0;
+  if (!dryrun)
+    for (int i=0; i < state.size(); ++i) if (state[i].isFinal()) nFinal++;
 
-    string name = it->first;
+  // Loop over the splittings that can act on the radiator and get
+  // overestimates.
+  for (int iSplit : splitDispatch[state[dip->iRadiator].isFinal()]) {
+    DireSplitting* split = splitList[iSplit];
+    const string& name  = splitNames[iSplit];
 
     // Check if splitting should partake in evolution.
-    bool allowed = it->second->useFastFunctions()
-                 ? it->second->canRadiate(state,dip->iRadiator,dip->iRecoiler)
-                 : it->second->canRadiate(state,iRadRec,bool_settings);
+    bool allowed = split->useFastFunctions()
+                 ? split->canRadiate(state,dip->iRadiator,dip->iRecoiler)
+                 : split->canRadiate(state,iRadRec,bool_settings);
 
     // Skip if splitting is not allowed.
     if (!allowed) continue;
 
     // Check if dipole end can really radiate this particle.
-    vector<int> re = it->second->radAndEmt(state[dip->iRadiator].id(),
+    vector<int> re = split->radAndEmt(state[dip->iRadiator].id(),
       dip->colType);
     if (int(re.size()) < 2) continue;
 
     for (int iEmtAft=1; iEmtAft < int(re.size()); ++iEmtAft) {
       int idEmtAft = re[iEmtAft];
-      if (it->second->is_qcd) {
+      if (split->is_qcd) {
         idEmtAft = abs(idEmtAft);
         if (idEmtAft<10) idEmtAft = 1;
       }
@@ -1704,9 +1745,9 @@ void DireSpace::getNewOverestimates( int idDau, DireSpaceEnd* dip,
 
     // No 1->3 conversion of heavy quarks below 2*m_q.
     if ( tOld < 4.*m2bPhys && abs(idDau) == 5
-      && it->second->nEmissions() == 2) continue;
+      && split->nEmissions() == 2) continue;
     else if ( tOld < 4.*m2cPhys && abs(idDau) == 4
-      && it->second->nEmissions() == 2) continue;
+      && split->nEmissions() == 2) continue;
 
     // Get kernel order.
     int order = kernelOrder;
@@ -1715,21 +1756,21 @@ void DireSpace::getNewOverestimates( int idDau, DireSpaceEnd* dip,
     bool hasInB = (getInB(dip->system) != 0);
     if (dip->system != 0 && hasInA && hasInB) order = kernelOrderMPI;
 
-    it->second->splitInfo.set_pT2Old  ( tOld );
-    it->second->splitInfo.storeRadBef(state[dip->iRadiator]);
-    it->second->splitInfo.storeRecBef(state[dip->iRecoiler]);
+    split->splitInfo.set_pT2Old  ( tOld );
+    split->splitInfo.storeRadBef(state[dip->iRadiator]);
+    split->splitInfo.storeRecBef(state[dip->iRecoiler]);
 
     // Discard below the cut-off for the splitting.
-    if (!it->second->aboveCutoff( tOld, state[dip->iRadiator],
+    if (!split->aboveCutoff( tOld, state[dip->iRadiator],
       state[dip->iRecoiler], dip->system, partonSystemsPtr)) continue;
 
     // Get overestimate (of splitting kernel only)
-    double wt = it->second->overestimateInt(zMinAbs, zMaxAbs, tOld,
-                                           dip->m2Dip, order);
+    double wt = split->overestimateInt(zMinAbs, zMaxAbs, tOld,
+                                      dip->m2Dip, order);
 
     // Calculate numerator of PDF ratio, and construct ratio.
     // PDF factors for Q -> GQ.
-    double pdfRatio = getPDFOverestimates(idDau, tOld, xDau, it->first,
+    double pdfRatio = getPDFOverestimates(idDau, tOld, xDau, name,
       false, -1., re[0], re[0]);
 
     // Include PDF ratio for Q->GQ or G->QQ.
@@ -1744,10 +1785,8 @@ void DireSpace::getNewOverestimates( int idDau, DireSpaceEnd* dip,
     double enhanceFurther = enhanceOverestimateFurther(name, idDau, tOld);
     wt *= enhanceFurther;
 
-    if (!dryrun && it->second->hasMECBef(state, tOld)) wt *= KERNEL_HEADROOM;
-    int nFinal = 0;
-    for (int i=0; i < state.size(); ++i) if (state[i].isFinal()) nFinal++;
-    if (!dryrun) wt *= it->second->overhead
+    if (!dryrun && split->hasMECBef(state, tOld)) wt *= KERNEL_HEADROOM;
+    if (!dryrun) wt *= split->overhead
                    (dip->m2Dip*xDau, state[dip->iRadiator].id(), nFinal);
 
     // Save this overestimate.
@@ -2104,7 +2143,7 @@ void DireSpace::getNewSplitting( const Event& state, DireSpaceEnd* dip,
       make_pair(state[dip->iRadiator].id(), state[dip->iRadiator].isFinal()),
       make_pair(state[dip->iRecoiler].id(), state[dip->iRecoiler].isFinal()));
   // Retrieve argument of alphaS.
-  double scale2 = splits[splittingNowName]->couplingScale2(dip->z, dip->pT2,
+  double scale2 = splittingNow->couplingScale2(dip->z, dip->pT2,
     m2dipCorr,
     make_pair (state[dip->iRadiator].id(), state[dip->iRadiator].isFinal()),
     make_pair (state[dip->iRecoiler].id(), state[dip->iRecoiler].isFinal()));
@@ -2743,6 +2782,7 @@ bool DireSpace::pT2nextQCD_II( double pT2begDip, double pT2sel,
     }
 
     splittingNowName="";
+    splittingNow = nullptr;
     fullWeightsNow.clear();
     fullWeightNow = overWeightNow = auxWeightNow = 0.;
 
@@ -2833,6 +2873,7 @@ bool DireSpace::pT2nextQCD_II( double pT2begDip, double pT2sel,
           splittingNowName = newOverestimates.rbegin()->second;
         else
           splittingNowName = newOverestimates.lower_bound(R0)->second;
+        splittingNow = splits[splittingNowName];
       }
       break;
     }
@@ -2867,6 +2908,7 @@ bool DireSpace::pT2nextQCD_II( double pT2begDip, double pT2sel,
         splittingNowName = newOverestimates.rbegin()->second;
       else
         splittingNowName = newOverestimates.lower_bound(R)->second;
+      splittingNow = splits[splittingNowName];
       getNewSplitting( event, &dip, teval, xMin, tnow, zMinAbs,
         zMaxAbs, idDaughter, splittingNowName, forceFixedAs, idMother,
         idSister, znow, wt, fullWeightsNow, overWeightNow);
@@ -2885,15 +2927,15 @@ bool DireSpace::pT2nextQCD_II( double pT2begDip, double pT2sel,
     // light quark -> heavy quark if pT has fallen below 2*mQuark.
     if ( tnow <= 4.*m2bPhys
       && ( (abs(idDaughter) == 21 && abs(idSister) == 5)
-      || (abs(idDaughter) == 5 && splits[splittingNowName]->nEmissions()==2)
-      || (abs(idSister) == 5 && splits[splittingNowName]->nEmissions()==2))) {
+      || (abs(idDaughter) == 5 && splittingNow->nEmissions()==2)
+      || (abs(idSister) == 5 && splittingNow->nEmissions()==2))) {
       fullWeightsNow.clear();
       wt = fullWeightNow = overWeightNow = auxWeightNow = 0.;
       nContinue++; continue;
     } else if ( tnow <= 4.*m2cPhys
       && ( (abs(idDaughter) == 21 && abs(idSister) == 4)
-      || (abs(idDaughter) == 4 && splits[splittingNowName]->nEmissions()==2)
-      || (abs(idSister) == 4 && splits[splittingNowName]->nEmissions()==2))) {
+      || (abs(idDaughter) == 4 && splittingNow->nEmissions()==2)
+      || (abs(idSister) == 4 && splittingNow->nEmissions()==2))) {
       fullWeightsNow.clear();
       wt = fullWeightNow = overWeightNow = auxWeightNow = 0.;
       nContinue++; continue;
@@ -2911,7 +2953,7 @@ bool DireSpace::pT2nextQCD_II( double pT2begDip, double pT2sel,
     // such splittings would not be included in the virtual corrections to the
     // 1->2 kernels. Note that the threshold is pT>mEmission,since alphaS is
     // evaluated at pT, not virtuality sa1).
-    if ( splits[splittingNowName]->nEmissions() == 2 )
+    if ( splittingNow->nEmissions() == 2 )
       if ( (abs(idSister) == 4 && tnow < m2cPhys)
         || (abs(idSister) == 5 && tnow < m2bPhys)) {
       needNewPDF = true;
@@ -2933,16 +2975,15 @@ bool DireSpace::pT2nextQCD_II( double pT2begDip, double pT2sel,
     // Jacobian for 1->3 splittings, in CS variables.
     double jacobian(1.);
 
-    bool canUseSplitInfo = splits[splittingNowName]->canUseForBranching();
+    bool canUseSplitInfo = splittingNow->canUseForBranching();
     if (canUseSplitInfo) {
       jacobian
-        = splits[splittingNowName]->getJacobian(event,partonSystemsPtr);
+        = splittingNow->getJacobian(event,partonSystemsPtr);
       unordered_map<string,double> psvars
-        = splits[splittingNowName]->
-        getPhasespaceVars( event, partonSystemsPtr);
+        = splittingNow->getPhasespaceVars( event, partonSystemsPtr);
       xMother = psvars["xInAft"];
     } else {
-      if ( splits[splittingNowName]->nEmissions() == 2 ) {
+      if ( splittingNow->nEmissions() == 2 ) {
         double za    = dip.z;
         double xa    = dip.xa;
         xCS          =  za * (q2 - m2a - m2i - m2j - m2k) / q2;
@@ -3013,8 +3054,8 @@ bool DireSpace::pT2nextQCD_II( double pT2begDip, double pT2sel,
 
     // Before generating kinematics: Reset sai if the kernel fell on an
     // endpoint contribution.
-    if ( splits[splittingNowName]->nEmissions() == 2 )
-      dip.sa1 = splits[splittingNowName]->splitInfo.kinematics()->sai;
+    if ( splittingNow->nEmissions() == 2 )
+      dip.sa1 = splittingNow->splitInfo.kinematics()->sai;
 
     if ( fullWeightNow == 0. ) {
       needNewPDF = true;
@@ -3024,7 +3065,7 @@ bool DireSpace::pT2nextQCD_II( double pT2begDip, double pT2sel,
     }
 
     // Retrieve argument of alphaS.
-    double scale2 =  splits[splittingNowName]->couplingScale2 ( dip.z, tnow,
+    double scale2 =  splittingNow->couplingScale2 ( dip.z, tnow,
       m2DipCorr,
       make_pair (event[dip.iRadiator].id(), event[dip.iRadiator].isFinal()),
       make_pair (event[dip.iRecoiler].id(), event[dip.iRecoiler].isFinal()));
@@ -3280,6 +3321,7 @@ bool DireSpace::pT2nextQCD_IF( double pT2begDip, double pT2sel,
     }
 
     splittingNowName="";
+    splittingNow = nullptr;
     fullWeightsNow.clear();
     fullWeightNow = overWeightNow = auxWeightNow = 0.;
 
@@ -3370,6 +3412,7 @@ bool DireSpace::pT2nextQCD_IF( double pT2begDip, double pT2sel,
           splittingNowName = newOverestimates.rbegin()->second;
         else
           splittingNowName = newOverestimates.lower_bound(R0)->second;
+        splittingNow = splits[splittingNowName];
       }
       break;
     }
@@ -3403,6 +3446,7 @@ bool DireSpace::pT2nextQCD_IF( double pT2begDip, double pT2sel,
         splittingNowName = newOverestimates.rbegin()->second;
       else
         splittingNowName = newOverestimates.lower_bound(R)->second;
+      splittingNow = splits[splittingNowName];
       getNewSplitting( event, &dip, teval, xMin, tnow, zMinAbs,
         zMaxAbs, idDaughter, splittingNowName, forceFixedAs, idMother,
         idSister, znow, wt, fullWeightsNow, overWeightNow);
@@ -3422,15 +3466,15 @@ bool DireSpace::pT2nextQCD_IF( double pT2begDip, double pT2sel,
     // light quark -> heavy quark if pT has fallen below 2*mQuark.
     if ( tnow <= 4.*m2bPhys
       && ( (abs(idDaughter) == 21 && abs(idSister) == 5)
-      || (abs(idDaughter) == 5 && splits[splittingNowName]->nEmissions()==2)
-      || (abs(idSister) == 5 && splits[splittingNowName]->nEmissions()==2))) {
+      || (abs(idDaughter) == 5 && splittingNow->nEmissions()==2)
+      || (abs(idSister) == 5 && splittingNow->nEmissions()==2))) {
       fullWeightsNow.clear();
       wt = fullWeightNow = overWeightNow = auxWeightNow = 0.;
       nContinue++; continue;
     } else if ( tnow <= 4.*m2cPhys
       && ( (abs(idDaughter) == 21 && abs(idSister) == 4)
-      || (abs(idDaughter) == 4 && splits[splittingNowName]->nEmissions()==2)
-      || (abs(idSister) == 4 && splits[splittingNowName]->nEmissions()==2))) {
+      || (abs(idDaughter) == 4 && splittingNow->nEmissions()==2)
+      || (abs(idSister) == 4 && splittingNow->nEmissions()==2))) {
       fullWeightsNow.clear();
       wt = fullWeightNow = overWeightNow = auxWeightNow = 0.;
       nContinue++; continue;
@@ -3453,7 +3497,7 @@ bool DireSpace::pT2nextQCD_IF( double pT2begDip, double pT2sel,
     // such splittings would not be included in the virtual corrections to the
     // 1->2 kernels. Note that the threshold is pT>mEmission,since alphaS is
     // evaluated at pT, not virtuality sa1).
-    if ( splits[splittingNowName]->nEmissions() == 2 )
+    if ( splittingNow->nEmissions() == 2 )
       if ( (abs(idSister) == 4 && tnow < m2cPhys)
         || (abs(idSister) == 5 && tnow < m2bPhys)) {
       needNewPDF = true;
@@ -3469,17 +3513,17 @@ bool DireSpace::pT2nextQCD_IF( double pT2begDip, double pT2sel,
     m2ai  = -dip.sa1 + m2a + m2i;
     double q2 = (event[iRadi].p()-event[iReco].p()).m2Calc();
 
-    bool canUseSplitInfo = splits[splittingNowName]->canUseForBranching();
+    bool canUseSplitInfo = splittingNow->canUseForBranching();
     if (canUseSplitInfo) {
       jacobian
-        = splits[splittingNowName]->getJacobian(event,partonSystemsPtr);
-      unordered_map<string,double> psvars = splits[splittingNowName]->
+        = splittingNow->getJacobian(event,partonSystemsPtr);
+      unordered_map<string,double> psvars = splittingNow->
         getPhasespaceVars( event, partonSystemsPtr);
       xMother = psvars["xInAft"];
     } else {
 
       // Jacobian for 1->3 splittings, in CS variables.
-      if ( splits[splittingNowName]->nEmissions() == 2 ) {
+      if ( splittingNow->nEmissions() == 2 ) {
         double m2jk = dip.pT2/dip.xa + q2*( 1. - dip.xa/dip.z) - m2ai;
 
         // Construnct the new initial state momentum, as needed to
@@ -3632,8 +3676,8 @@ bool DireSpace::pT2nextQCD_IF( double pT2begDip, double pT2sel,
 
     // Before generating kinematics: Reset sai if the kernel fell on an
     // endpoint contribution.
-    if ( splits[splittingNowName]->nEmissions() == 2 )
-      dip.sa1 = splits[splittingNowName]->splitInfo.kinematics()->sai;
+    if ( splittingNow->nEmissions() == 2 )
+      dip.sa1 = splittingNow->splitInfo.kinematics()->sai;
 
     if (fullWeightNow == 0.) {
       needNewPDF = true;
@@ -3644,7 +3688,7 @@ bool DireSpace::pT2nextQCD_IF( double pT2begDip, double pT2sel,
 
     // Retrieve argument of alphaS.
     double m2DipCorr  = dip.m2Dip - m2Bef + m2r + m2e;
-    double scale2 =  splits[splittingNowName]->couplingScale2 (
+    double scale2 =  splittingNow->couplingScale2 (
       dip.z, tnow, m2DipCorr,
       make_pair (event[dip.iRadiator].id(), event[dip.iRadiator].isFinal()),
       make_pair (event[dip.iRecoiler].id(), event[dip.iRecoiler].isFinal()));
@@ -280,12 +280,14 @@ void DireTimes::init( BeamParticle* beamAPtrIn,
   doVariations = settingsPtr->flag("Variations:doVariations");
   splittingSelName="";
   splittingNowName="";
+  splittingNow = nullptr;
 
   // Number of MPI, in case MPI forces intervention in shower weights.
   nMPI = 0;
 
   // Set splitting library, if already exists.
   if (splittingsPtr) splits = splittingsPtr->getSplittings();
+  setSplittingDispatch();
 
   overhead.clear();
   for ( unordered_map<string,DireSplitting*>::iterator it = splits.begin();
@@ -606,6 +608,7 @@ void DireTimes::prepare( int iSys, Event& event, bool limitPTmaxIn) {
 
   // Set splitting library.
   splits = splittingsPtr->getSplittings();
+  setSplittingDispatch();
   overhead.clear();
   for ( unordered_map<string,DireSplitting*>::iterator it = splits.begin();
     it != splits.end(); ++it ) {
@@ -693,6 +696,7 @@ void DireTimes::prepare( int iSys, Event& event, bool limitPTmaxIn) {
 
   splittingSelName="";
   splittingNowName="";
+  splittingNow = nullptr;
 
   // Clear weighted shower book-keeping.
   for ( unordered_map<string, multimap<double,double> >::iterator
@@ -714,6 +718,7 @@ void DireTimes::clear() {
 
   splittingSelName="";
   splittingNowName="";
+  splittingNow = nullptr;
 
   // Clear weighted shower book-keeping.
   for ( unordered_map<string, multimap<double,double> >::iterator
@@ -1692,6 +1697,30 @@ void DireTimes::checkDipoles(const Event& state) {
 
 //--------------------------------------------------------------------------
 
+// Fill the dispatch table of splitting kernels. The kernels keep the
+// order of the splitting library, so that results do not change.
+
+void DireTimes::setSplittingDispatch() {
+
+  splitList.clear();
+  splitNames.clear();
+  splitDispatch[0].clear();
+  splitDispatch[1].clear();
+  for ( unordered_map<string,DireSplitting*>::iterator it = splits.begin();
+    it != splits.end(); ++it ) {
+    int iSplit = splitList.size();
+    splitList.push_back(it->second);
+    splitNames.push_back(it->first);
+    // FSR kernels only act on final-state, ISR kernels only on initial-state
+    // radiators.
+    if (!it->second->is_fsr) splitDispatch[0].push_back(iSplit);
+    if (!it->second->is_isr) splitDispatch[1].push_back(iSplit);
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
 bool DireTimes::updateAllowedEmissions(const Event& state, DireTimesEnd* dip) {
   // Clear any allowed emissions.
   dip->clearAllowedEmt();
@@ -1712,17 +1741,19 @@ bool DireTimes::appendAllowedEmissions(const Event& state, DireTimesEnd* dip) {
   pair<int,int> iRadRec(make_pair(iRad, iRec));
   pair<int,int> iRecRad(make_pair(iRec, iRad));
 
-  for ( unordered_map<string,DireSplitting*>::iterator it = splits.begin();
-    it != splits.end(); ++it ) {
+  const vector<int>& splitsRad = splitDispatch[state[iRad].isFinal()];
+  const vector<int>& splitsRec = splitDispatch[state[iRec].isFinal()];
+  for (int iSplit : splitsRad) {
+    DireSplitting* split = splitList[iSplit];
 
     // Check if splitting is allowed.
-    bool allowed = it->second->useFastFunctions()
-                 ? it->second->canRadiate(state,iRad,iRec)
-                 : it->second->canRadiate(state,iRadRec,bool_settings);
+    bool allowed = split->useFastFunctions()
+                 ? split->canRadiate(state,iRad,iRec)
+                 : split->canRadiate(state,iRadRec,bool_settings);
     if (!allowed) continue;
 
     // Get emission id.
-    vector<int> re = it->second->radAndEmt( state[iRad].id(), dip->colType);
+    vector<int> re = split->radAndEmt( state[iRad].id(), dip->colType);
 
     // Do not decay resonances that were not generated by previous emissions.
     if ( particleDataPtr->isResonance(state[iRad].id())
@@ -1731,24 +1762,24 @@ bool DireTimes::appendAllowedEmissions(const Event& state, DireTimesEnd* dip) {
 
     for (int iEmtAft=1; iEmtAft < int(re.size()); ++iEmtAft) {
       int idEmtAft = re[iEmtAft];
-      if (it->second->is_qcd) {
+      if (split->is_qcd) {
         idEmtAft = abs(idEmtAft);
         if (idEmtAft<10) idEmtAft = 1;
       }
 
-      if (!it->second->isPartial()) {
+      if (!split->isPartial()) {
         dip->appendAllowedEmt(idEmtAft);
         isAllowed = true;
       } else {
         // Now check that emission also allowed when radiating from recoiler.
         bool isPartialFractioned = false;
-        for ( unordered_map<string,DireSplitting*>::iterator
-          itRec = splits.begin(); itRec != splits.end(); ++itRec ) {
+        for (int iSplitRec : splitsRec) {
+          DireSplitting* splitRec = splitList[iSplitRec];
 
           if ( isPartialFractioned ) break;
-          bool allowedRec = itRec->second->useFastFunctions()
-                 ? itRec->second->canRadiate(state,iRec,iRad)
-                 : itRec->second->canRadiate(state,iRecRad,bool_settings);
+          bool allowedRec = splitRec->useFastFunctions()
+                 ? splitRec->canRadiate(state,iRec,iRad)
+                 : splitRec->canRadiate(state,iRecRad,bool_settings);
 
           if (!allowedRec) continue;
 
@@ -1756,11 +1787,11 @@ bool DireTimes::appendAllowedEmissions(const Event& state, DireTimesEnd* dip) {
           int colTypeRec
             = state[iRec].isFinal() ? -dip->colType : dip->colType;
           vector<int> reRec
-            = itRec->second->radAndEmt( state[iRec].id(), colTypeRec);
+            = splitRec->radAndEmt( state[iRec].id(), colTypeRec);
 
           for (int iEmtAftRec=1; iEmtAftRec<int(reRec.size()); ++iEmtAftRec) {
             int idEmtAftRec = reRec[iEmtAftRec];
-            if (itRec->second->is_qcd) {
+            if (splitRec->is_qcd) {
               idEmtAftRec = abs(idEmtAftRec);
               if (idEmtAftRec<10) idEmtAftRec = 1;
             }
@@ -1795,6 +1826,7 @@ double DireTimes::pTnext( Event& event, double pTbegAll, double pTendAll,
   iDipSel = -1;
   double pT2sel = pTendAll * pTendAll;
   splittingNowName="";
+  splittingNow = nullptr;
   splittingSelName="";
   splitInfoSel.clear();
   kernelSel.clear();
@@ -1925,6 +1957,7 @@ double DireTimes::newPoint( const Event& inevt) {
   double pTendAll = 0.;
   double pT2sel = pTendAll * pTendAll;
   splittingNowName="";
+  splittingNow = nullptr;
   splittingSelName="";
   for ( unordered_map<string,DireSplitting*>::iterator it = splits.begin();
     it != splits.end(); ++it ) it->second->splitInfo.clear();
@@ -2020,7 +2053,8 @@ double DireTimes::newPoint( const Event& inevt) {
 
 //--------------------------------------------------------------------------
 
-double DireTimes::enhanceOverestimateFurther( string name, int, double tOld) {
+double DireTimes::enhanceOverestimateFurther( const string& name, int,
+  double tOld) {
 
   if (tOld < pT2minEnhance) return 1.;
   double enhance = weights->enhanceOverestimate(name);
@@ -2037,7 +2071,7 @@ double DireTimes::overheadFactorsMEC( const Event&, DireSplitInfo*, string) {
 //--------------------------------------------------------------------------
 
 double DireTimes::overheadFactors( DireTimesEnd* dip, const Event& state,
-  string name, double, double tOld, double xOld) {
+  const string& name, double, double tOld, double xOld) {
 
   double factor = 1.;
   double MARGIN = 1.;
@@ -2133,30 +2167,35 @@ void DireTimes::getNewOverestimates( DireTimesEnd* dip, const Event& state,
   double sum=0.;
   pair<int,int> iRadRec(make_pair(dip->iRadiator, dip->iRecoiler));
 
-  // Loop over splitting names and get overestimates.
-  for ( unordered_map<string,DireSplitting*>::iterator it = splits.begin();
-    it != splits.end(); ++it ) {
+  // Number of final-state particles, for the kernel overhead.
+  int nFinal = 0;
+  if (!dryrun)
+    for (int i=0; i < state.size(); ++i) if (state[i].isFinal()) nFinal++;
 
-    string name = it->first;
+  // Loop over the splittings that can act on the radiator and get
+  // overestimates.
+  for (int iSplit : splitDispatch[state[dip->iRadiator].isFinal()]) {
+    DireSplitting* split = splitList[iSplit];
+    const string& name  = splitNames[iSplit];
 
-    it->second->splitInfo.clear();
+    split->splitInfo.clear();
 
     // Check if splitting should partake in evolution.
-    bool allowed = it->second->useFastFunctions()
-                 ? it->second->canRadiate(state,dip->iRadiator,dip->iRecoiler)
-                 : it->second->canRadiate(state,iRadRec,bool_settings);
+    bool allowed = split->useFastFunctions()
+                 ? split->canRadiate(state,dip->iRadiator,dip->iRecoiler)
+                 : split->canRadiate(state,iRadRec,bool_settings);
 
     // Skip if splitting is not allowed.
     if (!allowed) continue;
 
     // Check if dipole end can really radiate this particle.
-    vector<int> re = it->second->radAndEmt(state[dip->iRadiator].id(),
+    vector<int> re = split->radAndEmt(state[dip->iRadiator].id(),
       dip->colType);
     if (int(re.size()) < 2) continue;
 
     for (int iEmtAft=1; iEmtAft < int(re.size()); ++iEmtAft) {
       int idEmtAft = re[iEmtAft];
-      if (it->second->is_qcd) {
+      if (split->is_qcd) {
         idEmtAft = abs(idEmtAft);
         if (idEmtAft<10) idEmtAft = 1;
       }
@@ -2168,12 +2207,12 @@ void DireTimes::getNewOverestimates( DireTimesEnd* dip, const Event& state,
     // Skip if splitting is not allowed.
     if (!allowed) continue;
 
-    it->second->splitInfo.set_pT2Old  ( tOld );
-    it->second->splitInfo.storeRadBef(state[dip->iRadiator]);
-    it->second->splitInfo.storeRecBef(state[dip->iRecoiler]);
+    split->splitInfo.set_pT2Old  ( tOld );
+    split->splitInfo.storeRadBef(state[dip->iRadiator]);
+    split->splitInfo.storeRecBef(state[dip->iRecoiler]);
 
     // Discard below the cut-off for the splitting.
-    if (!it->second->aboveCutoff( tOld, state[dip->iRadiator],
+    if (!split->aboveCutoff( tOld, state[dip->iRadiator],
       state[dip->iRecoiler], dip->system, partonSystemsPtr)) continue;
 
     // Get kernel order.
@@ -2193,8 +2232,8 @@ void DireTimes::getNewOverestimates( DireTimesEnd* dip, const Event& state,
     }
     if (hasHadMother) order = kernelOrderMPI;
 
-    double wt = it->second->overestimateInt(zMinAbs, zMaxAbs, tOld,
-                                           dip->m2Dip, order);
+    double wt = split->overestimateInt(zMinAbs, zMaxAbs, tOld,
+                                      dip->m2Dip, order);
 
     // Include artificial enhancements.
     wt *= overheadFactors(dip, state, name, dip->m2Dip, tOld, xOld);
@@ -2204,12 +2243,10 @@ void DireTimes::getNewOverestimates( DireTimesEnd* dip, const Event& state,
       = enhanceOverestimateFurther(name, state[dip->iRadiator].id(), tOld);
     wt *= enhanceFurther;
 
-    //if (it->second->hasMECBef(state, tOld)) wt *= KERNEL_HEADROOM;
+    //if (split->hasMECBef(state, tOld)) wt *= KERNEL_HEADROOM;
 
-    if (!dryrun && it->second->hasMECBef(state, tOld)) wt *= KERNEL_HEADROOM;
-    int nFinal = 0;
-    for (int i=0; i < state.size(); ++i) if (state[i].isFinal()) nFinal++;
-    if (!dryrun) wt *= it->second->overhead
+    if (!dryrun && split->hasMECBef(state, tOld)) wt *= KERNEL_HEADROOM;
+    if (!dryrun) wt *= split->overhead
                    (dip->m2Dip*xOld, state[dip->iRadiator].id(), nFinal);
 
     // Save this overestimate.
@@ -2581,7 +2618,7 @@ void DireTimes::getNewSplitting( const Event& state, DireTimesEnd* dip,
       make_pair(state[dip->iRadiator].id(), state[dip->iRadiator].isFinal()),
       make_pair(state[dip->iRecoiler].id(), state[dip->iRecoiler].isFinal()));
   // Retrieve argument of alphaS.
-  double scale2 = splits[splittingNowName]->couplingScale2(
+  double scale2 = splittingNow->couplingScale2(
     dip->z, dip->pT2, Q2,
     make_pair(state[dip->iRadiator].id(), state[dip->iRadiator].isFinal()),
     make_pair(state[dip->iRecoiler].id(), state[dip->iRecoiler].isFinal()));
@@ -3333,6 +3370,7 @@ bool DireTimes::pT2nextQCD_FF(double pT2begDip, double pT2sel,
     }
 
     splittingNowName ="";
+    splittingNow = nullptr;
     fullWeightsNow.clear();
     fullWeightNow = overWeightNow = auxWeightNow = 0.;
 
@@ -3380,6 +3418,7 @@ bool DireTimes::pT2nextQCD_FF(double pT2begDip, double pT2sel,
           splittingNowName = newOverestimates.rbegin()->second;
         else
           splittingNowName = newOverestimates.lower_bound(R0)->second;
+        splittingNow = splits[splittingNowName];
       }
       break;
     }
@@ -3402,6 +3441,7 @@ bool DireTimes::pT2nextQCD_FF(double pT2begDip, double pT2sel,
         splittingNowName = newOverestimates.rbegin()->second;
       else
         splittingNowName = newOverestimates.lower_bound(R)->second;
+      splittingNow = splits[splittingNowName];
 
       // Generate z value and calculate splitting probability.
       getNewSplitting( event, &dip, teval, 0., tnow, zMinAbs,
@@ -3453,12 +3493,12 @@ bool DireTimes::pT2nextQCD_FF(double pT2begDip, double pT2sel,
                    || dip.flavour == 22)
                ? getMass(dip.flavour,2) : getMass(dip.flavour,1);
 
-    bool canUseSplitInfo = splits[splittingNowName]->canUseForBranching();
+    bool canUseSplitInfo = splittingNow->canUseForBranching();
     if (canUseSplitInfo) {
-      m2r = splits[splittingNowName]->splitInfo.kinematics()->m2RadAft;
-      m2e = splits[splittingNowName]->splitInfo.kinematics()->m2EmtAft;
+      m2r = splittingNow->splitInfo.kinematics()->m2RadAft;
+      m2e = splittingNow->splitInfo.kinematics()->m2EmtAft;
     }
-    int nEmissions = splits[splittingNowName]->nEmissions();
+    int nEmissions = splittingNow->nEmissions();
 
     // Recalculate the kinematicaly available dipole mass.
     double Q2 = dip.m2Dip + m2Bef - m2r - m2e;
@@ -3480,11 +3520,11 @@ bool DireTimes::pT2nextQCD_FF(double pT2begDip, double pT2sel,
     // Pick remaining variables for 1->3 splitting.
     double m2aij(m2Bef), m2a(m2e), m2i(m2e), m2j(m2r), m2k(m2s);
     if (canUseSplitInfo)
-      m2j = splits[splittingNowName]->splitInfo.kinematics()->m2EmtAft2;
+      m2j = splittingNow->splitInfo.kinematics()->m2EmtAft2;
 
     double jacobian(1.);
     if (canUseSplitInfo) {
-      jacobian = splits[splittingNowName]->getJacobian(event,partonSystemsPtr);
+      jacobian = splittingNow->getJacobian(event,partonSystemsPtr);
     } else {
       // Calculate CS variables and scaled masses.
       double yCS = tnow/Q2 / (1. - z);
@@ -3524,7 +3564,7 @@ bool DireTimes::pT2nextQCD_FF(double pT2begDip, double pT2sel,
     // Before generating kinematics: Reset sai if the kernel fell on an
     // endpoint contribution.
     if ( nEmissions == 2
-      && splits[splittingNowName]->splitInfo.kinematics()->sai == 0.)
+      && splittingNow->splitInfo.kinematics()->sai == 0.)
         dip.sa1 = 0.;
 
     if (fullWeightNow == 0. ) {
@@ -3535,7 +3575,7 @@ bool DireTimes::pT2nextQCD_FF(double pT2begDip, double pT2sel,
     }
 
     // Retrieve argument of alphaS.
-    double scale2 =  splits[splittingNowName]->couplingScale2 ( z, tnow, Q2,
+    double scale2 =  splittingNow->couplingScale2 ( z, tnow, Q2,
       make_pair (event[dip.iRadiator].id(), event[dip.iRadiator].isFinal()),
       make_pair (event[dip.iRecoiler].id(), event[dip.iRecoiler].isFinal()));
     if (scale2 < 0.) scale2 = tnow;
@@ -3752,6 +3792,7 @@ bool DireTimes::pT2nextQCD_FI(double pT2begDip, double pT2sel,
     }
 
     splittingNowName ="";
+    splittingNow = nullptr;
     fullWeightsNow.clear();
     fullWeightNow = overWeightNow = auxWeightNow = 0.;
 
@@ -3843,6 +3884,7 @@ bool DireTimes::pT2nextQCD_FI(double pT2begDip, double pT2sel,
           splittingNowName = newOverestimates.rbegin()->second;
         else
           splittingNowName = newOverestimates.lower_bound(R0)->second;
+        splittingNow = splits[splittingNowName];
       }
       break;
     }
@@ -3881,6 +3923,7 @@ bool DireTimes::pT2nextQCD_FI(double pT2begDip, double pT2sel,
         splittingNowName = newOverestimates.rbegin()->second;
       else
         splittingNowName = newOverestimates.lower_bound(R)->second;
+      splittingNow = splits[splittingNowName];
 
       // Generate z value and calculate splitting probability.
       double xMin = (hasPDFrec) ? xRecoiler : 0.;
@@ -3927,13 +3970,13 @@ bool DireTimes::pT2nextQCD_FI(double pT2begDip, double pT2sel,
                  ? getMass(dip.flavour,2)
                  : getMass(dip.flavour,1);
 
-    bool canUseSplitInfo = splits[splittingNowName]->canUseForBranching();
+    bool canUseSplitInfo = splittingNow->canUseForBranching();
     if (canUseSplitInfo) {
-      m2Bef = splits[splittingNowName]->splitInfo.kinematics()->m2RadBef;
-      m2r   = splits[splittingNowName]->splitInfo.kinematics()->m2RadAft;
-      m2e   = splits[splittingNowName]->splitInfo.kinematics()->m2EmtAft;
+      m2Bef = splittingNow->splitInfo.kinematics()->m2RadBef;
+      m2r   = splittingNow->splitInfo.kinematics()->m2RadAft;
+      m2e   = splittingNow->splitInfo.kinematics()->m2EmtAft;
     }
-    int nEmissions = splits[splittingNowName]->nEmissions();
+    int nEmissions = splittingNow->nEmissions();
 
     double q2    = (event[dip.iRecoiler].p()
                    -event[dip.iRadiator].p()).m2Calc();
@@ -3968,7 +4011,7 @@ bool DireTimes::pT2nextQCD_FI(double pT2begDip, double pT2sel,
 
     double m2a(m2e), m2i(m2e), m2j(m2Bef), m2aij(m2Bef), m2k(0.0);
     if (canUseSplitInfo)
-      m2j = splits[splittingNowName]->splitInfo.kinematics()->m2EmtAft2;
+      m2j = splittingNow->splitInfo.kinematics()->m2EmtAft2;
 
     // Recalculate the kinematicaly available dipole mass.
     // Calculate CS variables.
@@ -3981,9 +4024,9 @@ bool DireTimes::pT2nextQCD_FI(double pT2begDip, double pT2sel,
     double jacobian = 1.;
     if (canUseSplitInfo) {
       jacobian
-        = splits[splittingNowName]->getJacobian(event,partonSystemsPtr);
+        = splittingNow->getJacobian(event,partonSystemsPtr);
       unordered_map<string,double> psvars
-        = splits[splittingNowName]->getPhasespaceVars(event, partonSystemsPtr);
+        = splittingNow->getPhasespaceVars(event, partonSystemsPtr);
       xNew = psvars["xInAft"];
     }
 
@@ -4096,7 +4139,7 @@ bool DireTimes::pT2nextQCD_FI(double pT2begDip, double pT2sel,
     // Before generating kinematics: Reset sai if the kernel fell on an
     // endpoint contribution.
     if ( nEmissions == 2
-      && splits[splittingNowName]->splitInfo.kinematics()->sai == 0.)
+      && splittingNow->splitInfo.kinematics()->sai == 0.)
       dip.sa1 = 0.;
 
     if (fullWeightNow == 0. ) {
@@ -4106,7 +4149,7 @@ bool DireTimes::pT2nextQCD_FI(double pT2begDip, double pT2sel,
     }
 
     // Retrieve argument of alphaS.
-    double scale2 =  splits[splittingNowName]->couplingScale2 ( z, tnow, Q2,
+    double scale2 =  splittingNow->couplingScale2 ( z, tnow, Q2,
       make_pair (event[dip.iRadiator].id(), event[dip.iRadiator].isFinal()),
       make_pair (event[dip.iRecoiler].id(), event[dip.iRecoiler].isFinal()));
     if (scale2 < 0.) scale2 = tnow;
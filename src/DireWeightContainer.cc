@@ -156,11 +156,7 @@ void DireWeightContainer::setup() {
     }
   }
 
-  string vkey = "base";
-  rejectWeight.insert( make_pair(vkey, map<ulong, DirePSWeight>() ));
-  acceptWeight.insert( make_pair(vkey, map<ulong, DirePSWeight>() ));
-  showerWeight.insert( make_pair(vkey, 1.) );
-  weightNames.push_back( vkey );
+  bookWeightVar("base",false);
 
   bool doVar = settingsPtr->flag("Variations:doVariations");
   if ( doVar ) {
@@ -239,136 +235,98 @@ void DireWeightContainer::setup() {
 
 void DireWeightContainer::bookWeightVar( string vkey, bool checkSettings) {
   bool insert = !checkSettings || settingsPtr->parm(vkey) != 1.0;
-  if (insert) {
-    rejectWeight.insert( make_pair(vkey, map<ulong, DirePSWeight>() ));
-    acceptWeight.insert( make_pair(vkey, map<ulong, DirePSWeight>() ));
-    showerWeight.insert( make_pair(vkey, 1.) );
+  if (insert && weightIndices.find(vkey) == weightIndices.end()) {
+    weightIndices.insert( make_pair(vkey, int(weightNames.size())) );
     weightNames.push_back( vkey );
+    rejectWeight.push_back( map<ulong,double>() );
+    acceptWeight.push_back( map<ulong,double>() );
+    showerWeightVal.push_back( 1. );
   }
 }
 
 //--------------------------------------------------------------------------
 
-void DireWeightContainer::setWeight( string varKey, double value) {
-  unordered_map<string, double>::iterator it = showerWeight.find( varKey );
-  if ( it == showerWeight.end() ) return;
-  it->second = value;
+void DireWeightContainer::setWeight( int iVar, double value) {
+  if (iVar < 0) return;
+  showerWeightVal[iVar] = value;
 }
 
 //--------------------------------------------------------------------------
 
 void DireWeightContainer::resetAcceptWeight( double pT2key, double value,
-  string varKey) {
-  unordered_map<string, map<ulong, DirePSWeight> >::iterator
-    it0 = acceptWeight.find( varKey );
-  if ( it0 == acceptWeight.end() ) return;
-  map<ulong, DirePSWeight>::iterator
-    it = acceptWeight[varKey].find( key(pT2key) );
-  if ( it == acceptWeight[varKey].end() ) return;
-  acceptWeight[varKey].erase(it);
-  acceptWeight[varKey].insert( make_pair( key(pT2key),
-                                          DirePSWeight(value,1,0,pT2key,"")));
+  int iVar) {
+  if (iVar < 0) return;
+  map<ulong,double>::iterator it = acceptWeight[iVar].find( key(pT2key) );
+  if ( it == acceptWeight[iVar].end() ) return;
+  it->second = value;
 }
 
 //--------------------------------------------------------------------------
 
 void DireWeightContainer::resetRejectWeight( double pT2key, double value,
-  string varKey) {
-  unordered_map<string, map<ulong, DirePSWeight> >::iterator
-    it0 = rejectWeight.find( varKey );
-  if ( it0 == rejectWeight.end() ) return;
-  map<ulong, DirePSWeight>::iterator
-    it = rejectWeight[varKey].find( key(pT2key) );
-  if ( it == rejectWeight[varKey].end() ) return;
-  rejectWeight[varKey].erase(it);
-  rejectWeight[varKey].insert( make_pair( key(pT2key),
-                                          DirePSWeight(value,1,0,pT2key,"")));
+  int iVar) {
+  if (iVar < 0) return;
+  map<ulong,double>::iterator it = rejectWeight[iVar].find( key(pT2key) );
+  if ( it == rejectWeight[iVar].end() ) return;
+  it->second = value;
 }
 
 //--------------------------------------------------------------------------
 
-void DireWeightContainer::eraseAcceptWeight( double pT2key, string varKey) {
-  unordered_map<string, map<ulong, DirePSWeight> >::iterator
-    it0 = acceptWeight.find( varKey );
-  if ( it0 == acceptWeight.end() ) return;
-  map<ulong, DirePSWeight>::iterator
-    it = acceptWeight[varKey].find( key(pT2key) );
-  if ( it == acceptWeight[varKey].end() ) return;
-  acceptWeight[varKey].erase(it);
+void DireWeightContainer::eraseAcceptWeight( double pT2key, int iVar) {
+  if (iVar < 0) return;
+  acceptWeight[iVar].erase( key(pT2key) );
 }
 
 //--------------------------------------------------------------------------
 
-void DireWeightContainer::eraseRejectWeight( double pT2key, string varKey) {
-  unordered_map<string, map<ulong, DirePSWeight> >::iterator it0 =
-    rejectWeight.find( varKey );
-  if ( it0 == rejectWeight.end() ) return;
-  map<ulong, DirePSWeight>::iterator it =
-    rejectWeight[varKey].find( key(pT2key) );
-  if ( it == rejectWeight[varKey].end() ) return;
-  rejectWeight[varKey].erase(it);
+void DireWeightContainer::eraseRejectWeight( double pT2key, int iVar) {
+  if (iVar < 0) return;
+  rejectWeight[iVar].erase( key(pT2key) );
 }
 
 //--------------------------------------------------------------------------
 
-double DireWeightContainer::getAcceptWeight( double pT2key, string varKey) {
-  unordered_map<string, map<ulong, DirePSWeight> >::iterator it0 =
-    acceptWeight.find( varKey );
-  if ( it0 == acceptWeight.end() ) return 0./0.;
-  map<ulong, DirePSWeight>::iterator it =
-    acceptWeight[varKey].find( key(pT2key) );
-  if ( it == acceptWeight[varKey].end() ) return 0./0.;
-  return it->second.weight();
+double DireWeightContainer::getAcceptWeight( double pT2key, int iVar) {
+  if (iVar < 0) return 0./0.;
+  map<ulong,double>::iterator it = acceptWeight[iVar].find( key(pT2key) );
+  if ( it == acceptWeight[iVar].end() ) return 0./0.;
+  return it->second;
 }
 
 
 //--------------------------------------------------------------------------
 
-double DireWeightContainer::getRejectWeight( double pT2key, string varKey) {
-  unordered_map<string, map<ulong, DirePSWeight> >::iterator it0 =
-    rejectWeight.find( varKey );
-  if ( it0 == rejectWeight.end() ) return 0./0.;
-  map<ulong, DirePSWeight>::iterator it =
-    rejectWeight[varKey].find( key(pT2key) );
-  if ( it == rejectWeight[varKey].end() ) return 0./0.;
-  return it->second.weight();
+double DireWeightContainer::getRejectWeight( double pT2key, int iVar) {
+  if (iVar < 0) return 0./0.;
+  map<ulong,double>::iterator it = rejectWeight[iVar].find( key(pT2key) );
+  if ( it == rejectWeight[iVar].end() ) return 0./0.;
+  return it->second;
 }
 
 //--------------------------------------------------------------------------
 
 // Attach accept/reject probabilities for a proposed shower step.
-void DireWeightContainer::insertWeights( map<double,double> aWeight,
-  multimap<double,double> rWeight, string varKey ) {
+void DireWeightContainer::insertWeights( const map<double,double>& aWeight,
+  const multimap<double,double>& rWeight, int iVar ) {
 
-  unordered_map<string, map<ulong, DirePSWeight> >::iterator itA0 =
-    acceptWeight.find( varKey );
-  if ( itA0 == acceptWeight.end() ) return;
-  unordered_map<string, map<ulong, DirePSWeight> >::iterator itR0 =
-    rejectWeight.find( varKey );
-  if ( itR0 == rejectWeight.end() ) return;
+  if (iVar < 0) return;
+  map<ulong,double>& accept = acceptWeight[iVar];
+  map<ulong,double>& reject = rejectWeight[iVar];
 
   // New accept weights.
-  for ( map<double,double>::iterator it = aWeight.begin();
-    it != aWeight.end(); ++it ){
-    map<ulong, DirePSWeight>::iterator itLo
-      = acceptWeight[varKey].find( key(it->first) );
-    if (itLo == acceptWeight[varKey].end())
-      acceptWeight[varKey].insert(make_pair( key(it->first),
-                                   DirePSWeight(it->second,1,0,it->first,"")));
-    else
-      itLo->second *= it->second;
+  for ( map<double,double>::const_iterator it = aWeight.begin();
+    it != aWeight.end(); ++it ) {
+    pair<map<ulong,double>::iterator,bool> itLo
+      = accept.insert( make_pair( key(it->first), it->second) );
+    if (!itLo.second) itLo.first->second *= it->second;
   }
   // New reject weights.
-  for ( multimap<double,double>::iterator it = rWeight.begin();
-    it != rWeight.end(); ++it ){
-    map<ulong, DirePSWeight>::iterator itLo
-      = rejectWeight[varKey].find( key(it->first) );
-    if (itLo == rejectWeight[varKey].end())
-      rejectWeight[varKey].insert
-        (make_pair( key(it->first),
-                    DirePSWeight(it->second,-1,0,it->first,"")));
-    else
-      itLo->second *= it->second;
+  for ( multimap<double,double>::const_iterator it = rWeight.begin();
+    it != rWeight.end(); ++it ) {
+    pair<map<ulong,double>::iterator,bool> itLo
+      = reject.insert( make_pair( key(it->first), it->second) );
+    if (!itLo.second) itLo.first->second *= it->second;
   }
 }
 
@@ -379,29 +337,28 @@ void DireWeightContainer::calcWeight(double pT2, bool includeAcceptAtPT2,
   bool includeRejectAtPT2) {
 
   // Loop though weights.
-  for ( unordered_map<string, map<ulong, DirePSWeight> >::iterator
-    it = rejectWeight.begin(); it != rejectWeight.end(); ++it ) {
+  ulong keyPT2 = key(pT2);
+  for (int iVar = 0; iVar < int(rejectWeight.size()); ++iVar) {
     // Set accept weight.
-    bool hasAccept  = ( acceptWeight[it->first].find(key(pT2))
-                     != acceptWeight[it->first].end());
-    double acceptWt = (hasAccept && includeAcceptAtPT2)
-                     ? acceptWeight[it->first].find(key(pT2))->second.weight()
-                     : 1.;
+    double acceptWt = 1.;
+    if (includeAcceptAtPT2) {
+      map<ulong,double>::iterator itA = acceptWeight[iVar].find(keyPT2);
+      if (itA != acceptWeight[iVar].end()) acceptWt = itA->second;
+    }
 
     // Now multiply rejection weights.
     double rejectWt = 1.;
-    for ( map<ulong, DirePSWeight>::reverse_iterator itR
-      = it->second.rbegin(); itR != it->second.rend(); ++itR ){
-        if ( includeRejectAtPT2 && itR->first == key(pT2) ) {
-          rejectWt *= itR->second.weight(); }
-        if ( itR->first > key(pT2) ) { rejectWt *= itR->second.weight(); }
-        if ( itR->first < key(pT2) || itR->first-key(pT2) == 0) break;
+    for ( map<ulong,double>::reverse_iterator itR
+      = rejectWeight[iVar].rbegin(); itR != rejectWeight[iVar].rend();
+      ++itR ) {
+        if ( includeRejectAtPT2 && itR->first == keyPT2 ) {
+          rejectWt *= itR->second; }
+        if ( itR->first > keyPT2 ) { rejectWt *= itR->second; }
+        if ( itR->first <= keyPT2 ) break;
     }
 
     // Remember weights
-    unordered_map<string, double>::iterator itW = showerWeight.find(it->first);
-
-    if (itW != showerWeight.end()) itW->second *= acceptWt*rejectWt;
+    showerWeightVal[iVar] *= acceptWt*rejectWt;
 
   }
 
@@ -412,39 +369,31 @@ void DireWeightContainer::calcWeight(double pT2, bool includeAcceptAtPT2,
 // Function to calculate the weight of the shower evolution step.
 pair<double,double> DireWeightContainer::getWeight(double pT2, string varKey) {
 
+  int iVar = weightIndex(varKey);
+  if (iVar < 0) return make_pair(1.,1.);
+  ulong keyPT2 = key(pT2);
+
   // Set accept weight.
-  bool hasAccept  = ( acceptWeight[varKey].find(key(pT2))
-                   != acceptWeight[varKey].end());
-  double acceptWt = (hasAccept)
-                   ? acceptWeight[varKey].find(key(pT2))->second.weight()
-                   : 1.;
+  map<ulong,double>::iterator itA = acceptWeight[iVar].find(keyPT2);
+  double acceptWt = (itA != acceptWeight[iVar].end()) ? itA->second : 1.;
 
   // Now multiply rejection weights.
   double rejectWt = 1.;
-  unordered_map<string, map<ulong, DirePSWeight> >::iterator itRW
-    = rejectWeight.find(varKey);
-  if (itRW != rejectWeight.end()) {
-
-    // Now multiply rejection weights.
-    for ( map<ulong, DirePSWeight>::reverse_iterator itR
-      = itRW->second.rbegin(); itR != itRW->second.rend();
-      ++itR ){
-        if ( itR->first > key(pT2) ) rejectWt *= itR->second.weight();
-        if ( itR->first < key(pT2) || itR->first-key(pT2) == 0) break;
-    }
-
+  for ( map<ulong,double>::reverse_iterator itR
+    = rejectWeight[iVar].rbegin(); itR != rejectWeight[iVar].rend();
+    ++itR ){
+      if ( itR->first > keyPT2 ) rejectWt *= itR->second;
+      if ( itR->first <= keyPT2 ) break;
   }
 
   // Remember weights
-  unordered_map<string, double>::iterator itW = showerWeight.find(varKey);
-
-  if (itW != showerWeight.end()
-    && abs(itW->second) > LARGEWT) direInfoPtr->message(1) << scientific
+  double showerWt = showerWeightVal[iVar];
+  if (abs(showerWt) > LARGEWT) direInfoPtr->message(1) << scientific
     << setprecision(8) << __FILE__ << " " << __func__ << " "
-    << __LINE__ << " : Found large shower weight=" << itW->second
+    << __LINE__ << " : Found large shower weight=" << showerWt
     << " at pT2=" << pT2 << endl;
 
-  if (itW != showerWeight.end()) rejectWt *= itW->second;
+  rejectWt *= showerWt;
 
   // Diagnostic messages.
   if (abs(acceptWt) > LARGEWT) direInfoPtr->message(1) << scientific
@@ -452,16 +401,17 @@ pair<double,double> DireWeightContainer::getWeight(double pT2, string varKey) {
     << __LINE__ << " : Found large accept weight=" << acceptWt
     << " at pT2=" << pT2 << endl;
   if ( abs(rejectWt) > LARGEWT) {
-    for ( map<ulong, DirePSWeight>::reverse_iterator itR
-      = itRW->second.rbegin(); itR != itRW->second.rend(); ++itR ){
-      if ( itR->first > key(pT2) ) {
-        if ( abs(itR->second.weight()) > LARGEWT) direInfoPtr->message(1)
+    for ( map<ulong,double>::reverse_iterator itR
+      = rejectWeight[iVar].rbegin(); itR != rejectWeight[iVar].rend();
+      ++itR ){
+      if ( itR->first > keyPT2 ) {
+        if ( abs(itR->second) > LARGEWT) direInfoPtr->message(1)
           << scientific << setprecision(8) << __FILE__ << " " << __func__
           << " " << __LINE__ << " : Found large reject weight="
-          << itR->second.weight() << " at index=" << itR->first
+          << itR->second << " at index=" << itR->first
           << " (pT2 approx. " << dkey(itR->first) << ")" << endl;
       }
-      if ( itR->first < key(pT2) || itR->first-key(pT2) == 0) break;
+      if ( itR->first <= keyPT2 ) break;
     }
   }
 
@@ -836,6 +836,93 @@ void Event::listJunctions() const {
 
 //--------------------------------------------------------------------------
 
+// Save a checkpoint of the event record. Vector assignment reuses the
+// memory already allocated for the checkpoint. The particles keep
+// pointing to this event, so need not be updated when restored.
+
+void Event::saveCheckpoint(Event& checkpoint) const {
+
+  checkpoint.particleDataPtr      = particleDataPtr;
+  checkpoint.entry                = entry;
+  checkpoint.junction             = junction;
+  checkpoint.startColTag          = startColTag;
+  checkpoint.maxColTag            = maxColTag;
+  checkpoint.savedSize            = savedSize;
+  checkpoint.savedJunctionSize    = savedJunctionSize;
+  checkpoint.savedPartonLevelSize = savedPartonLevelSize;
+  checkpoint.scaleSave            = scaleSave;
+  checkpoint.scaleSecondSave      = scaleSecondSave;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Roll back the event record to a checkpoint. Entries added since are
+// removed, and the remaining ones copied back without reallocation.
+
+void Event::restoreCheckpoint(const Event& checkpoint) {
+
+  entry                = checkpoint.entry;
+  junction             = checkpoint.junction;
+  startColTag          = checkpoint.startColTag;
+  maxColTag            = checkpoint.maxColTag;
+  savedSize            = checkpoint.savedSize;
+  savedJunctionSize    = checkpoint.savedJunctionSize;
+  savedPartonLevelSize = checkpoint.savedPartonLevelSize;
+  scaleSave            = checkpoint.scaleSave;
+  scaleSecondSave      = checkpoint.scaleSecondSave;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Rotate all particles and vertices of the event. Same operations as in
+// Vec4::rot, but with the angles only evaluated once.
+
+void Event::rot(double theta, double phi) {
+
+  double cthe = cos(theta);
+  double sthe = sin(theta);
+  double cphi = cos(phi);
+  double sphi = sin(phi);
+  double cc   = cthe * cphi;
+  double cs   = cthe * sphi;
+  double sc   = sthe * cphi;
+  double ss   = sthe * sphi;
+  for (int i = 0; i < size(); ++i) {
+    Particle& pNow = entry[i];
+    for (int iVec = 0; iVec < 2; ++iVec) {
+      if (iVec == 1 && !pNow.hasVertex()) break;
+      Vec4 v = (iVec == 0) ? pNow.p() : pNow.vProd();
+      double xx = v.px();
+      double yy = v.py();
+      double zz = v.pz();
+      v.px(  cc * xx - sphi * yy + sc * zz);
+      v.py(  cs * xx + cphi * yy + ss * zz);
+      v.pz( -sthe * xx + cthe * zz);
+      if (iVec == 0) pNow.p(v);
+      else           pNow.vProd(v);
+    }
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
+// Boost all particles and vertices of the event, with the gamma factor
+// evaluated once. Nothing is done for an unphysical boost.
+
+void Event::bst(double betaX, double betaY, double betaZ) {
+
+  double beta2 = betaX*betaX + betaY*betaY + betaZ*betaZ;
+  if (beta2 >= 1.) return;
+  double gamma = 1. / sqrt(1. - beta2);
+  bst( betaX, betaY, betaZ, gamma);
+
+}
+
+//--------------------------------------------------------------------------
+
 // Operator overloading allows to append one event to an existing one.
 
 Event& Event::operator+=( const Event& addEvent) {
@@ -894,4 +981,183 @@ Event& Event::operator+=( const Event& addEvent) {
 
 //==========================================================================
 
+// EventMomenta class.
+// This class holds momenta and vertices of an event as separate arrays.
+
+//--------------------------------------------------------------------------
+
+// Copy momenta, masses, status codes and optionally vertices from an event.
+
+void EventMomenta::fill(const Event& event, bool withVertices) {
+
+  int n = event.size();
+  px.resize(n);
+  py.resize(n);
+  pz.resize(n);
+  e.resize(n);
+  m.resize(n);
+  status.resize(n);
+  for (int i = 0; i < n; ++i) {
+    const Particle& pNow = event[i];
+    px[i]     = pNow.px();
+    py[i]     = pNow.py();
+    pz[i]     = pNow.pz();
+    e[i]      = pNow.e();
+    m[i]      = pNow.m();
+    status[i] = pNow.status();
+  }
+
+  // Vertices are zero when not set, and remain so when transformed.
+  int nVtx = (withVertices) ? n : 0;
+  xProd.resize(nVtx);
+  yProd.resize(nVtx);
+  zProd.resize(nVtx);
+  tProd.resize(nVtx);
+  hasVertex.resize(nVtx);
+  for (int i = 0; i < nVtx; ++i) {
+    const Particle& pNow = event[i];
+    xProd[i]     = pNow.xProd();
+    yProd[i]     = pNow.yProd();
+    zProd[i]     = pNow.zProd();
+    tProd[i]     = pNow.tProd();
+    hasVertex[i] = pNow.hasVertex();
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
+// Copy momenta, masses and existing vertices back into the event record.
+
+void EventMomenta::store(Event& event) const {
+
+  int n = min( size(), event.size());
+  for (int i = 0; i < n; ++i) {
+    event[i].p( px[i], py[i], pz[i], e[i]);
+    event[i].m( m[i]);
+  }
+  int nVtx = min( n, int(tProd.size()));
+  for (int i = 0; i < nVtx; ++i) if (hasVertex[i])
+    event[i].vProd( xProd[i], yProd[i], zProd[i], tProd[i]);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Apply a transformation to all momenta and vertices.
+
+template<typename Kernel> void EventMomenta::transform(Kernel kernel) {
+
+  kernel( size(), px.data(), py.data(), pz.data(), e.data());
+  kernel( int(tProd.size()), xProd.data(), yProd.data(), zProd.data(),
+    tProd.data());
+
+}
+
+//--------------------------------------------------------------------------
+
+// Rotate all momenta and vertices, as in Vec4::rot.
+
+void EventMomenta::rot(double theta, double phi) {
+
+  double cthe = cos(theta);
+  double sthe = sin(theta);
+  double cphi = cos(phi);
+  double sphi = sin(phi);
+  double cc   = cthe * cphi;
+  double cs   = cthe * sphi;
+  double sc   = sthe * cphi;
+  double ss   = sthe * sphi;
+  transform( [=](int n, double* x, double* y, double* z, double*) {
+    for (int i = 0; i < n; ++i) {
+      double xx = x[i];
+      double yy = y[i];
+      double zz = z[i];
+      x[i] =  cc * xx - sphi * yy + sc * zz;
+      y[i] =  cs * xx + cphi * yy + ss * zz;
+      z[i] = -sthe * xx + cthe * zz;
+    }
+  });
+
+}
+
+//--------------------------------------------------------------------------
+
+// Boost all momenta and vertices, as in Vec4::bst.
+
+void EventMomenta::bst(double betaX, double betaY, double betaZ) {
+
+  double beta2 = betaX*betaX + betaY*betaY + betaZ*betaZ;
+  if (beta2 >= 1.) return;
+  double gamma = 1. / sqrt(1. - beta2);
+  bst( betaX, betaY, betaZ, gamma);
+
+}
+
+void EventMomenta::bst(double betaX, double betaY, double betaZ,
+  double gamma) {
+
+  transform( [=](int n, double* x, double* y, double* z, double* t) {
+    for (int i = 0; i < n; ++i) {
+      double prod1 = betaX * x[i] + betaY * y[i] + betaZ * z[i];
+      double prod2 = gamma * (gamma * prod1 / (1. + gamma) + t[i]);
+      x[i] += prod2 * betaX;
+      y[i] += prod2 * betaY;
+      z[i] += prod2 * betaZ;
+      t[i]  = gamma * (t[i] + prod1);
+    }
+  });
+
+}
+
+//--------------------------------------------------------------------------
+
+// Rotate and boost all momenta and vertices, as in Vec4::rotbst.
+
+void EventMomenta::rotbst(const RotBstMatrix& M) {
+
+  // Local copy of the matrix, so that it can be kept in registers.
+  double m00 = M.value(0, 0), m01 = M.value(0, 1), m02 = M.value(0, 2),
+         m03 = M.value(0, 3), m10 = M.value(1, 0), m11 = M.value(1, 1),
+         m12 = M.value(1, 2), m13 = M.value(1, 3), m20 = M.value(2, 0),
+         m21 = M.value(2, 1), m22 = M.value(2, 2), m23 = M.value(2, 3),
+         m30 = M.value(3, 0), m31 = M.value(3, 1), m32 = M.value(3, 2),
+         m33 = M.value(3, 3);
+  transform( [=](int n, double* x, double* y, double* z, double* t) {
+    for (int i = 0; i < n; ++i) {
+      double xx = x[i];
+      double yy = y[i];
+      double zz = z[i];
+      double tt = t[i];
+      t[i] = m00 * tt + m01 * xx + m02 * yy + m03 * zz;
+      x[i] = m10 * tt + m11 * xx + m12 * yy + m13 * zz;
+      y[i] = m20 * tt + m21 * xx + m22 * yy + m23 * zz;
+      z[i] = m30 * tt + m31 * xx + m32 * yy + m33 * zz;
+    }
+  });
+
+}
+
+//--------------------------------------------------------------------------
+
+// Sum of momenta of all or of final-state particles. The status is
+// turned into a weight, so that the loop contains no branches.
+
+Vec4 EventMomenta::pSum(bool onlyFinal) const {
+
+  double sx = 0., sy = 0., sz = 0., st = 0.;
+  int n = size();
+  for (int i = 0; i < n; ++i) {
+    double wt = (!onlyFinal || status[i] > 0) ? 1. : 0.;
+    sx += wt * px[i];
+    sy += wt * py[i];
+    sz += wt * pz[i];
+    st += wt * e[i];
+  }
+  return Vec4( sx, sy, sz, st);
+
+}
+
+//==========================================================================
+
 } // end namespace Pythia8
@@ -73,6 +73,11 @@ bool HadronWidths::init(string path) {
 
 bool HadronWidths::init(istream& stream) {
 
+  // Tables for mass and channel selection are rebuilt when needed.
+  useMassTables = flag("HadronWidths:useMassTables");
+  massTables.clear();
+  decayTables.clear();
+
   string line;
 
   while (getline(stream, line)) {
@@ -420,6 +425,33 @@ double HadronWidths::br(int idR, int idA, int idB, double m) const {
 
 //--------------------------------------------------------------------------
 
+// Get the branching ratio for the specified decay channel of the particle,
+// and also return the total width, using a single table lookup.
+
+double HadronWidths::br(int idR, int idA, int idB, double m,
+  double& widthOut) const {
+
+  // Total width as in width(...), branching ratio as in br(...).
+  auto entryIter = entries.find(abs(idR));
+  widthOut = (entryIter != entries.end()) ? entryIter->second.width(m)
+           : particleDataPtr->mWidth(idR);
+  if (idR < 0 || entryIter == entries.end())
+    return 0.;
+
+  pair<int, int> key = getKey(idR, idA, idB);
+  auto channelIter = entryIter->second.decayChannels.find(key);
+  if (channelIter == entryIter->second.decayChannels.end())
+    return 0.;
+
+  if (widthOut == 0.)
+    return 0.;
+  else
+    return (m <= channelIter->second.mThreshold) ? 0.
+          : channelIter->second.partialWidth(m) / widthOut;
+}
+
+//--------------------------------------------------------------------------
+
 // Get the mass distribution density for the particle at the specified mass.
 
 double HadronWidths::mDistr(int id, double m) const  {
@@ -449,32 +481,38 @@ bool HadronWidths::pickDecay(int idDec, double m, int& idAOut, int& idBOut,
   }
   HadronWidthEntry& entry = entriesIter->second;
 
-  // Pick decay channel.
-  vector<pair<int, int>> prodsList;
-  vector<double> sigmas;
-  bool gotAny = false;
-  for (auto& channel : entry.decayChannels) {
-    if (m <= channel.second.mThreshold)
-      continue;
-    double sigma = channel.second.partialWidth(m);
-    if (sigma > 0.) {
-      gotAny = true;
-      prodsList.push_back(channel.first);
-      sigmas.push_back(sigma);
+  // Pick decay channel from tables if possible.
+  const ResonanceDecayChannel* channelPtr = nullptr;
+  if (useMassTables) channelPtr = pickChannelTab(idDec, entry, m);
+
+  // Else pick decay channel by evaluating all partial widths.
+  if (channelPtr == nullptr) {
+    vector<pair<int, int>> prodsList;
+    vector<double> sigmas;
+    bool gotAny = false;
+    for (auto& channel : entry.decayChannels) {
+      if (m <= channel.second.mThreshold)
+        continue;
+      double sigma = channel.second.partialWidth(m);
+      if (sigma > 0.) {
+        gotAny = true;
+        prodsList.push_back(channel.first);
+        sigmas.push_back(sigma);
+      }
     }
-  }
-  if (!gotAny) {
-     infoPtr->errorMsg("Error in HadronWidths::pickDecay: "
-       "no channels have positive widths",
-       "for " + to_string(idDec) + " @ " + to_string(m) + " GeV");
-    return false;
+    if (!gotAny) {
+       infoPtr->errorMsg("Error in HadronWidths::pickDecay: "
+         "no channels have positive widths",
+         "for " + to_string(idDec) + " @ " + to_string(m) + " GeV");
+      return false;
+    }
+    channelPtr = &entry.decayChannels.at(prodsList[rndmPtr->pick(sigmas)]);
   }
 
   // Select decay products. Check spin type of decay.
-  pair<int, int> prods = prodsList[rndmPtr->pick(sigmas)];
-  int idA = prods.first;
-  int idB = prods.second;
-  int lType = entry.decayChannels.at(prods).lType;
+  int idA = channelPtr->prodA;
+  int idB = channelPtr->prodB;
+  int lType = channelPtr->lType;
 
   // Select masses of decay products.
   double mA, mB;
@@ -500,6 +538,7 @@ bool HadronWidths::pickDecay(int idDec, double m, int& idAOut, int& idBOut,
 static constexpr int    MAXLOOP        = 100;
 static constexpr double MINWIDTH       = 0.001;
 static constexpr double MAXWIDTHGROWTH = 2.;
+static constexpr int    NMASSTAB       = 200;
 
 //--------------------------------------------------------------------------
 
@@ -572,6 +611,12 @@ bool HadronWidths::pickMasses(int idA, int idB, double eCM,
   double p2Max  = (eCM*eCM - pow2(mAMin + mBMin))
                 * (eCM*eCM - pow2(mAMin - mBMin));
 
+  // Running-width Breit-Wigners can be sampled directly from tables.
+  const MassTable* tableA = (useMassTables && hasVarWidthA)
+    ? massTable(abs(idA), *entryA) : nullptr;
+  const MassTable* tableB = (useMassTables && hasVarWidthB)
+    ? massTable(abs(idB), *entryB) : nullptr;
+
   // Loop over attempts to pick the two masses simultaneously.
   double wtTot, gammaAVar, gammaBVar, bwAFix, bwBFix, bwAVar, bwBVar;
   for (int i = 0; i < MAXLOOP; ++i) {
@@ -581,24 +626,29 @@ bool HadronWidths::pickMasses(int idA, int idB, double eCM,
     if (2 * i > MAXLOOP) {
       hasVarWidthA = false;
       hasVarWidthB = false;
+      tableA       = nullptr;
+      tableB       = nullptr;
     }
     if (4 * i > 3 * MAXLOOP) lType = 0;
 
-    // Initially pick according to simple Breit-Wigner.
-    if (hasWidthA) mAOut = mAFix + 0.5 * gammaAFix * tan(bwAMin
+    // Initially pick according to simple or tabulated Breit-Wigner.
+    if (tableA != nullptr) mAOut = pickMassTab(*tableA, mAMax);
+    else if (hasWidthA) mAOut = mAFix + 0.5 * gammaAFix * tan(bwAMin
       + rndmPtr->flat() * (bwAMax - bwAMin));
-    if (hasWidthB) mBOut = mBFix + 0.5 * gammaBFix * tan(bwBMin
+    if (tableB != nullptr) mBOut = pickMassTab(*tableB, mBMax);
+    else if (hasWidthB) mBOut = mBFix + 0.5 * gammaBFix * tan(bwBMin
       + rndmPtr->flat() * (bwBMax - bwBMin));
 
-    // Correction given by BW(Gamma_now)/BW(Gamma_fix) for variable width.
+    // Correction given by BW(Gamma_now)/BW(Gamma_fix) for variable width,
+    // unless already included in the tables.
     // Note: width not allowed to explode at large masses.
-    if (hasVarWidthA) {
+    if (hasVarWidthA && tableA == nullptr) {
       gammaAVar = min(entryA->width(mAOut), MAXWIDTHGROWTH * gammaAFix);
       bwAVar    = gammaAVar / (pow2( mAOut - mAFix) + 0.25 * pow2(gammaAVar));
       bwAFix    = gammaAFix / (pow2( mAOut - mAFix) + 0.25 * pow2(gammaAFix));
       wtTot    *= bwAVar / (bwAFix * MAXWIDTHGROWTH);
     }
-    if (hasVarWidthB) {
+    if (hasVarWidthB && tableB == nullptr) {
       gammaBVar = min(entryB->width(mBOut), MAXWIDTHGROWTH * gammaBFix);
       bwBVar    = gammaBVar / (pow2( mBOut - mBFix) + 0.25 * pow2(gammaBVar));
       bwBFix    = gammaBFix / (pow2( mBOut - mBFix) + 0.25 * pow2(gammaBFix));
@@ -632,6 +682,185 @@ bool HadronWidths::pickMasses(int idA, int idB, double eCM,
 
 //--------------------------------------------------------------------------
 
+// Get the cumulative mass distribution of a particle with running width,
+// tabulated in the fixed-width Breit-Wigner variable. The weight is the
+// same BW(Gamma_now)/BW(Gamma_fix) ratio that pickMasses otherwise uses
+// in its accept/reject step, and is linearly interpolated between points.
+
+const HadronWidths::MassTable* HadronWidths::massTable(int idAbs,
+  const HadronWidthEntry& entry) {
+
+  // Return existing table. An empty table means it cannot be used.
+  auto iter = massTables.find(idAbs);
+  if (iter != massTables.end())
+    return iter->second.cumul.empty() ? nullptr : &iter->second;
+  MassTable& table = massTables[idAbs];
+
+  // Range of the Breit-Wigner variable.
+  double m0     = particleDataPtr->m0(idAbs);
+  double mMin   = particleDataPtr->mMin(idAbs);
+  double mMax   = particleDataPtr->mMax(idAbs);
+  double gamma0 = entry.width(m0);
+  if (gamma0 <= 0. || mMin >= mMax) return nullptr;
+  table.m0     = m0;
+  table.gamma0 = gamma0;
+  table.bwMin  = atan(2. * (mMin - m0) / gamma0);
+  table.dbw    = (atan(2. * (mMax - m0) / gamma0) - table.bwMin) / NMASSTAB;
+
+  // Weights at the grid points and the integral up to each of them.
+  // Note: width not allowed to explode at large masses.
+  table.wts.resize(NMASSTAB + 1);
+  table.cumul.resize(NMASSTAB + 1);
+  for (int i = 0; i <= NMASSTAB; ++i) {
+    double m = m0 + 0.5 * gamma0 * tan(table.bwMin + i * table.dbw);
+    m = clamp(m, mMin, mMax);
+    double gammaVar = min(entry.width(m), MAXWIDTHGROWTH * gamma0);
+    double bwVar = gammaVar / (pow2(m - m0) + 0.25 * pow2(gammaVar));
+    double bwFix = gamma0 / (pow2(m - m0) + 0.25 * pow2(gamma0));
+    table.wts[i] = min(bwVar / bwFix, MAXWIDTHGROWTH);
+    table.cumul[i] = (i == 0) ? 0. : table.cumul[i - 1]
+      + 0.5 * table.dbw * (table.wts[i - 1] + table.wts[i]);
+  }
+
+  // Done, unless the distribution vanishes.
+  if (table.cumul.back() <= 0.) {
+    table.cumul.clear();
+    return nullptr;
+  }
+  return &table;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Sample a mass below mMaxNow from a tabulated mass distribution, using
+// a binary search for the bin and a linear weight inside the bin.
+
+double HadronWidths::pickMassTab(const MassTable& table, double mMaxNow) {
+
+  // Integral up to the current upper mass limit.
+  int nBin        = table.wts.size() - 1;
+  double bwMaxNow = atan(2. * (mMaxNow - table.m0) / table.gamma0);
+  double xMax     = max(0., (bwMaxNow - table.bwMin) / table.dbw);
+  int jMax        = min(int(xMax), nBin - 1);
+  double tMax     = min(xMax - jMax, 1.);
+  double wLo      = table.wts[jMax];
+  double dwMax    = table.wts[jMax + 1] - wLo;
+  double cumulMax = table.cumul[jMax]
+                  + table.dbw * tMax * (wLo + 0.5 * dwMax * tMax);
+
+  // Use the fixed-width Breit-Wigner if nothing is left below the limit.
+  if (cumulMax <= 0.) return table.m0 + 0.5 * table.gamma0
+    * tan(table.bwMin + rndmPtr->flat() * (bwMaxNow - table.bwMin));
+
+  // Find the bin with a binary search.
+  double cumulNow = rndmPtr->flat() * cumulMax;
+  int j = upper_bound( table.cumul.begin(), table.cumul.begin() + jMax + 1,
+    cumulNow) - table.cumul.begin() - 1;
+  j = max(0, j);
+
+  // Position inside the bin from the integral of the linear weight,
+  // i.e. solve a t + b t^2 / 2 = c for t in a numerically stable way.
+  double a     = table.wts[j];
+  double b     = table.wts[j + 1] - a;
+  double c     = (cumulNow - table.cumul[j]) / table.dbw;
+  double denom = a + sqrt(max(0., a * a + 2. * b * c));
+  double t     = (denom > 0.) ? clamp(2. * c / denom, 0., 1.) : 0.;
+  if (j == jMax) t = min(t, tMax);
+  return table.m0 + 0.5 * table.gamma0
+    * tan(table.bwMin + (j + t) * table.dbw);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Get the cumulative partial widths of all decay channels at each of the
+// interpolation points of a particle.
+
+const HadronWidths::DecayTable* HadronWidths::decayTable(int idAbs,
+  const HadronWidthEntry& entry) {
+
+  // Return existing table. An empty table means it cannot be used.
+  auto iter = decayTables.find(idAbs);
+  if (iter != decayTables.end())
+    return iter->second.cumul.empty() ? nullptr : &iter->second;
+  DecayTable& table = decayTables[idAbs];
+
+  // All channels must be tabulated at the points of the total width,
+  // with non-negative partial widths.
+  const LinearInterpolator& width = entry.width;
+  int nPoint = width.data().size();
+  if (nPoint < 2 || entry.decayChannels.empty()) return nullptr;
+  for (auto& channel : entry.decayChannels) {
+    const LinearInterpolator& widthNow = channel.second.partialWidth;
+    bool isValid = int(widthNow.data().size()) == nPoint
+      && widthNow.left() == width.left() && widthNow.right() == width.right();
+    for (double widthPoint : widthNow.data())
+      if (widthPoint < 0.) isValid = false;
+    if (!isValid) {
+      table.channels.clear();
+      return nullptr;
+    }
+    table.channels.push_back(&channel.second);
+  }
+
+  // Sum up partial widths at each point.
+  int nChan = table.channels.size();
+  table.cumul.resize(nPoint * nChan);
+  for (int i = 0; i < nPoint; ++i) {
+    double sum = 0.;
+    for (int k = 0; k < nChan; ++k) {
+      sum += table.channels[k]->partialWidth.data()[i];
+      table.cumul[i * nChan + k] = sum;
+    }
+  }
+  return &table;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Pick a decay channel from tabulated partial widths. The linearly
+// interpolated partial widths are a mixture of the values at the two
+// nearest points, so first pick one of the points and then a channel
+// according to the partial widths there. Returns nullptr if the tables
+// cannot be used, so that all partial widths are evaluated instead.
+
+const HadronWidths::ResonanceDecayChannel* HadronWidths::pickChannelTab(
+  int idAbs, const HadronWidthEntry& entry, double m) {
+
+  const DecayTable* tablePtr = decayTable(idAbs, entry);
+  if (tablePtr == nullptr) return nullptr;
+
+  // Find the interpolation bin and the weights of its two points.
+  int nPoint = entry.width.data().size();
+  int nChan  = tablePtr->channels.size();
+  double x   = (m - entry.width.left()) / entry.width.dx();
+  int j      = int(floor(x));
+  if (j < 0 || j >= nPoint - 1) return nullptr;
+  double wLo = (1. - (x - j)) * tablePtr->cumul[j * nChan + nChan - 1];
+  double wHi = (x - j) * tablePtr->cumul[(j + 1) * nChan + nChan - 1];
+  if (wLo + wHi <= 0.) return nullptr;
+
+  // Pick point and channel. Channels closed at this mass are rejected,
+  // which is equivalent to leaving them out from the start.
+  for (int iTry = 0; iTry < MAXLOOP; ++iTry) {
+    int iPoint = (rndmPtr->flat() * (wLo + wHi) < wLo) ? j : j + 1;
+    auto rowBeg = tablePtr->cumul.begin() + iPoint * nChan;
+    double cumulNow = rndmPtr->flat() * rowBeg[nChan - 1];
+    int k = min( int(upper_bound(rowBeg, rowBeg + nChan, cumulNow) - rowBeg),
+      nChan - 1);
+    if (m > tablePtr->channels[k]->mThreshold)
+      return tablePtr->channels[k];
+  }
+
+  // Failed; evaluate all partial widths instead.
+  return nullptr;
+
+}
+
+//--------------------------------------------------------------------------
+
 // Calculate the total width of the particle without using interpolation.
 
 double HadronWidths::widthCalc(int id, double m) const {
@@ -811,6 +1040,10 @@ bool HadronWidths::parameterize(int id, int precision) {
     });
   }
 
+  // Tables built from the old parameterization are no longer valid.
+  massTables.clear();
+  decayTables.clear();
+
   // Create new or update existing HadronWidthEntry.
   HadronWidthEntry newEntry {
     LinearInterpolator(mMin, mMax, totalWidthData),
@@ -970,6 +1203,8 @@ void HadronWidths::parameterizeAll(int precision) {
 
   // Clear existing data and parameterize new data.
   entries.clear();
+  massTables.clear();
+  decayTables.clear();
 
   for (ParticleDataEntryPtr entry : variableWidthEntries) {
     if (!parameterizeRecursive(entry->id(), precision)) {
@@ -63,12 +63,11 @@ void HelicityMatrixElement::calculateD(vector<HelicityParticle>& p) {
   // Initialize the wave functions.
   initWaves(p);
 
-  // Create the helicity vectors.
-  vector<int> h1(p.size(),0);
-  vector<int> h2(p.size(),0);
-
-  // Call the recursive sub-method.
-  calculateD(p, h1, h2, 0);
+  // Tabulate the matrix element and sum over all helicity pairs.
+  if (calculateAmplitudes(p)) do {
+    p[0].D[hel1[0]][hel2[0]] += amps[ampIndex(hel1)]
+      * conj(amps[ampIndex(hel2)]) * calculateProductD(p, hel1, hel2);
+  } while (nextHelicities(p));
 
   // Normalize the decay matrix.
   p[0].normalize(p[0].D);
@@ -77,27 +76,6 @@ void HelicityMatrixElement::calculateD(vector<HelicityParticle>& p) {
 
 //--------------------------------------------------------------------------
 
-// Recursive sub-method for calculating a particle's decay matrix.
-
-void HelicityMatrixElement::calculateD(vector<HelicityParticle>& p,
-  vector<int>& h1, vector<int>& h2, unsigned int i) {
-
-  if (i < p.size()) {
-    for (h1[i] = 0; h1[i] < p[i].spinStates(); h1[i]++) {
-        for (h2[i] = 0; h2[i] < p[i].spinStates(); h2[i]++) {
-          calculateD(p, h1, h2, i+1);
-        }
-    }
-  }
-  else {
-    p[0].D[h1[0]][h2[0]] += calculateME(h1) * conj(calculateME(h2)) *
-        calculateProductD(p, h1, h2);
-  }
-
-}
-
-//--------------------------------------------------------------------------
-
 // Calculate a particle's helicity density matrix.
 
 void HelicityMatrixElement::calculateRho(unsigned int idx,
@@ -113,46 +91,23 @@ void HelicityMatrixElement::calculateRho(unsigned int idx,
   // Initialize the wave functions.
   initWaves(p);
 
-  // Create the helicity vectors.
-  vector<int> h1(p.size(),0);
-  vector<int> h2(p.size(),0);
-
-  // Call the recursive sub-method.
-  calculateRho(idx, p, h1, h2, 0);
-
-  // Normalize the density matrix.
-  p[idx].normalize(p[idx].rho);
-
-}
-
-//--------------------------------------------------------------------------
-
-// Recursive sub-method for calculating a particle's helicity density matrix.
-
-void HelicityMatrixElement::calculateRho(unsigned int idx,
-  vector<HelicityParticle>& p, vector<int>& h1, vector<int>& h2,
-  unsigned int i) {
-
-  if (i < p.size()) {
-    for (h1[i] = 0; h1[i] < p[i].spinStates(); h1[i]++) {
-        for (h2[i] = 0; h2[i] < p[i].spinStates(); h2[i]++) {
-          calculateRho(idx, p, h1, h2, i+1);
-        }
-    }
-  }
-  else {
+  // Tabulate the matrix element and sum over all helicity pairs.
+  if (calculateAmplitudes(p)) do {
     // Calculate rho from a hard process.
     if (p[1].direction < 0)
-        p[idx].rho[h1[idx]][h2[idx]] += p[0].rho[h1[0]][h2[0]] *
-          p[1].rho[h1[1]][h2[1]] * calculateME(h1)*conj(calculateME(h2)) *
-          calculateProductD(idx, 2, p, h1, h2);
+        p[idx].rho[hel1[idx]][hel2[idx]] += p[0].rho[hel1[0]][hel2[0]] *
+          p[1].rho[hel1[1]][hel2[1]] * amps[ampIndex(hel1)]
+          * conj(amps[ampIndex(hel2)])
+          * calculateProductD(idx, 2, p, hel1, hel2);
     // Calculate rho from a decay.
     else
-        p[idx].rho[h1[idx]][h2[idx]] += p[0].rho[h1[0]][h2[0]] *
-          calculateME(h1)*conj(calculateME(h2)) *
-          calculateProductD(idx, 1, p, h1, h2);
-    return;
-  }
+        p[idx].rho[hel1[idx]][hel2[idx]] += p[0].rho[hel1[0]][hel2[0]] *
+          amps[ampIndex(hel1)] * conj(amps[ampIndex(hel2)]) *
+          calculateProductD(idx, 1, p, hel1, hel2);
+  } while (nextHelicities(p));
+
+  // Normalize the density matrix.
+  p[idx].normalize(p[idx].rho);
 
 }
 
@@ -167,12 +122,11 @@ double HelicityMatrixElement::decayWeight(vector<HelicityParticle>& p) {
   // Initialize the wave functions.
   initWaves(p);
 
-  // Create the helicity vectors.
-  vector<int> h1(p.size(),0);
-  vector<int> h2(p.size(),0);
-
-  // Call the recursive sub-method.
-  decayWeight(p, h1, h2, weight, 0);
+  // Tabulate the matrix element and sum over all helicity pairs.
+  if (calculateAmplitudes(p)) do {
+    weight += p[0].rho[hel1[0]][hel2[0]] * amps[ampIndex(hel1)] *
+        conj(amps[ampIndex(hel2)]) * calculateProductD(p, hel1, hel2);
+  } while (nextHelicities(p));
 
   return real(weight);
 
@@ -180,22 +134,55 @@ double HelicityMatrixElement::decayWeight(vector<HelicityParticle>& p) {
 
 //--------------------------------------------------------------------------
 
-// Recursive sub-method for calculating a decay's weight.
+// Calculate the matrix element once for each helicity configuration,
+// since the helicity sums need each value many times. Also reset the
+// helicity pair to the first one of the sums. Return false if there
+// is no helicity configuration at all.
 
-void HelicityMatrixElement::decayWeight(vector<HelicityParticle>& p,
-  vector<int>& h1, vector<int>& h2, complex& weight, unsigned int i) {
+bool HelicityMatrixElement::calculateAmplitudes(vector<HelicityParticle>& p) {
 
-  if (i < p.size()) {
-    for (h1[i] = 0; h1[i] < p[i].spinStates(); h1[i]++) {
-        for (h2[i] = 0; h2[i] < p[i].spinStates(); h2[i]++) {
-          decayWeight(p, h1, h2, weight, i+1);
-        }
+  // Find the table size, with the helicity of the last particle
+  // running fastest.
+  int n = p.size();
+  hel1.assign(n, 0);
+  hel2.assign(n, 0);
+  hStride.resize(n);
+  int nAmps = 1;
+  for (int i = n - 1; i >= 0; --i) {
+    if (p[i].spinStates() <= 0) return false;
+    hStride[i] = nAmps;
+    nAmps     *= p[i].spinStates();
+  }
+
+  // Fill the table, using the first configuration as work vector.
+  amps.resize(nAmps);
+  for (int iAmp = 0; iAmp < nAmps; ++iAmp) {
+    amps[iAmp] = calculateME(hel1);
+    for (int i = n - 1; i >= 0; --i) {
+      if (++hel1[i] < p[i].spinStates()) break;
+      hel1[i] = 0;
     }
   }
-  else {
-    weight += p[0].rho[h1[0]][h2[0]] * calculateME(h1) *
-        conj(calculateME(h2)) * calculateProductD(p, h1, h2);
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Step to the next pair of helicity configurations, in the same order
+// as nested loops over the helicities of the two configurations,
+// particle by particle.
+// Return false when all pairs have been visited.
+
+bool HelicityMatrixElement::nextHelicities(vector<HelicityParticle>& p) {
+
+  for (int i = int(p.size()) - 1; i >= 0; --i) {
+    if (++hel2[i] < p[i].spinStates()) return true;
+    hel2[i] = 0;
+    if (++hel1[i] < p[i].spinStates()) return true;
+    hel1[i] = 0;
   }
+  return false;
 
 }
 
@@ -70,11 +70,11 @@ const int History::NTRIAL = 1;
 
 History::History( int depthIn,
          double scalein,
-         Event statein,
+         const Event& statein,
          Clustering c,
          MergingHooksPtr mergingHooksPtrIn,
-         BeamParticle beamAIn,
-         BeamParticle beamBIn,
+         const BeamParticle& beamAIn,
+         const BeamParticle& beamBIn,
          ParticleData* particleDataPtrIn,
          Info* infoPtrIn,
          PartonLevel* showersIn,
@@ -161,32 +161,74 @@ History::History( int depthIn,
 
   bool qcd = ( nFinalP > mergingHooksPtr->hardProcess->nQuarksOut() );
 
-  // If this is not the fully clustered state, try to find possible
-  // QCD clusterings.
-  vector<Clustering> clusterings;
-  if ( qcd && depth > 0 ) clusterings = getAllQCDClusterings();
+  // If requested, look up the clusterings of this state in the states
+  // already met along other paths. Only states at least two steps away
+  // from the input state can be reached along several paths. Colour
+  // shuffling may change the state while clustering, and plugin
+  // clusterings are not tracked, so never share states in these cases.
+  vector<Clustering>* shared = 0;
+  bool isNewState = true;
+  vector<double> key;
+  vector<int> iCanon, iInState;
+  if ( depth > 0 && mother && mother->mother
+    && mergingHooksPtr->shareHistoryStates()
+    && !mergingHooksPtr->allowColourShuffling()
+    && !mergingHooksPtr->useShowerPlugin()
+    && canonicalState(key, iCanon, iInState) ) {
+    key.push_back(depth);
+    shared = &sharedClusterings(key, isNewState);
+  }
 
-  bool dow = ( mergingHooksPtr->doWeakClustering()
-    && nFinalP > 1 && nFinalW+nFinalZ > 0 );
+  vector<Clustering> clusterings;
+  if ( !isNewState ) {
+    // Translate the shared clusterings to the positions in this state.
+    clusterings = *shared;
+    for (int i = 0; i < int(clusterings.size()); ++i) {
+      clusterings[i].emitted  = iInState[clusterings[i].emitted];
+      clusterings[i].emittor  = iInState[clusterings[i].emittor];
+      clusterings[i].recoiler = iInState[clusterings[i].recoiler];
+      clusterings[i].partner  = iInState[clusterings[i].partner];
+    }
 
-  // If necessary, try to find possible EW clusterings.
-  vector<Clustering> clusteringsEW;
-  //  if ( depth > 0 && mergingHooksPtr->doWeakClustering() )
-  if ( depth > 0 && dow )
-    clusteringsEW = getAllEWClusterings();
-  if ( !clusteringsEW.empty() ) {
-    clusterings.insert( clusterings.end(), clusteringsEW.begin(),
-                        clusteringsEW.end() );
+  } else {
+    // If this is not the fully clustered state, try to find possible
+    // QCD clusterings.
+    if ( qcd && depth > 0 ) clusterings = getAllQCDClusterings();
+
+    bool dow = ( mergingHooksPtr->doWeakClustering()
+      && nFinalP > 1 && nFinalW+nFinalZ > 0 );
+
+    // If necessary, try to find possible EW clusterings.
+    vector<Clustering> clusteringsEW;
+    //  if ( depth > 0 && mergingHooksPtr->doWeakClustering() )
+    if ( depth > 0 && dow )
+      clusteringsEW = getAllEWClusterings();
+    if ( !clusteringsEW.empty() ) {
+      clusterings.insert( clusterings.end(), clusteringsEW.begin(),
+                          clusteringsEW.end() );
+    }
+
+    // If necessary, try to find possible SQCD clusterings.
+    vector<Clustering> clusteringsSQCD;
+    if ( depth > 0 && mergingHooksPtr->doSQCDClustering() )
+      clusteringsSQCD = getAllSQCDClusterings();
+    if ( !clusteringsSQCD.empty() )
+      clusterings.insert( clusterings.end(), clusteringsSQCD.begin(),
+                          clusteringsSQCD.end() );
+
+    // Store the clusterings, in canonical positions, for other paths.
+    if ( shared ) {
+      *shared = clusterings;
+      for (int i = 0; i < int(clusterings.size()); ++i) {
+        Clustering& clus = (*shared)[i];
+        clus.emitted  = iCanon[clus.emitted];
+        clus.emittor  = iCanon[clus.emittor];
+        clus.recoiler = iCanon[clus.recoiler];
+        clus.partner  = iCanon[clus.partner];
+      }
+    }
   }
 
-  // If necessary, try to find possible SQCD clusterings.
-  vector<Clustering> clusteringsSQCD;
-  if ( depth > 0 && mergingHooksPtr->doSQCDClustering() )
-    clusteringsSQCD = getAllSQCDClusterings();
-  if ( !clusteringsSQCD.empty() )
-    clusterings.insert( clusterings.end(), clusteringsSQCD.begin(),
-                        clusteringsSQCD.end() );
-
   // If no clusterings were found, the recursion is done and we
   // register this node.
   if ( clusterings.empty() ) {
@@ -194,6 +236,7 @@ History::History( int depthIn,
     prob *= hardProcessME(state);
     if (registerPath( *this, isOrdered, isStronglyOrdered, isAllowed,
       depth == 0 )) updateMinDepth(depth);
+    if ( !mother ) sharedStatesSave.clear();
     return;
   }
 
@@ -262,29 +305,38 @@ History::History( int depthIn,
       }
     }
 
+    // Skip if this branch is already strongly suppressed. The probability
+    // does not depend on the reclustered state, so check this before
+    // performing the clustering.
+    double p = getProb(*it->second);
+    if (abs(p)*prob < 1e-10*probMax()) continue;
+
+    // Perform the clustering. The reclustered state is used both for the
+    // cut on the reclustered state and for the next history node.
+    Event reclusteredState = cluster(*it->second);
+
     // Check if reclustered state should be disallowed.
     bool doCut = mergingHooksPtr->canCutOnRecState()
               || mergingHooksPtr->allowCutOnRecState();
     bool allowed = isAllowed;
     if (  doCut
-      && mergingHooksPtr->doCutOnRecState(cluster(*it->second)) ) {
+      && mergingHooksPtr->doCutOnRecState(reclusteredState) ) {
       if ( onlyAllowedPaths()  ) continue;
       allowed = false;
     }
 
-    // Skip if this branch is already strongly suppressed.
-    double p = getProb(*it->second);
-    if (abs(p)*prob < 1e-10*probMax()) continue;
     updateProbMax(abs(p)*prob,depth==0);
 
-    // Perform the clustering and recurse and construct the next
-    // history node.
-    children.push_back(new History(depth - 1, t, cluster(*it->second),
+    // Recurse and construct the next history node.
+    children.push_back(new History(depth - 1, t, reclusteredState,
            *it->second, mergingHooksPtr, beamA, beamB, particleDataPtr,
            infoPtr, showers, coupSMPtr, ordered, stronglyOrdered, allowed,
            true, prob*p, this ));
   }
 
+  // The shared clusterings are only needed while the tree is constructed.
+  if ( !mother ) sharedStatesSave.clear();
+
 }
 
 //--------------------------------------------------------------------------
@@ -306,10 +358,13 @@ bool History::projectOntoDesiredHistories() {
 //                       repository of pointers to initialise alphaS
 //     PartonSystems* : PartonSystems object needed to initialise
 //                      shower objects
+//     vector<TrialShowerWorker>* : Optional workers to perform the trial
+//                      showers of the selected path concurrently
 // OUT double         : (Sukadov) , (alpha_S ratios) , (PDF ratios)
 
 vector<double> History::weightCKKWL(PartonLevel* trial, AlphaStrong * asFSR,
-  AlphaStrong * asISR, AlphaEM * aemFSR, AlphaEM * aemISR, double RN) {
+  AlphaStrong * asISR, AlphaEM * aemFSR, AlphaEM * aemISR, double RN,
+  vector<TrialShowerWorker>* workersPtr) {
 
   if ( mergingHooksPtr->canCutOnRecState() && !foundAllowedPath ) {
     string message="Warning in History::weightCKKWL: No allowed history";
@@ -341,6 +396,12 @@ vector<double> History::weightCKKWL(PartonLevel* trial, AlphaStrong * asFSR,
   // Set scales in the states to the scales pythia would have set
   selected->setScalesInHistory();
 
+  // Optionally perform the trial showers of the path concurrently, to be
+  // picked up below.
+  if ( workersPtr && !workersPtr->empty()
+    && !mergingHooksPtr->doWeakClustering() )
+    selected->doTrialShowers( *workersPtr, maxScale);
+
   int nWgts = mergingHooksPtr->nWgts;
   // Get weight.
   vector<double> sudakov( nWgts, 1. );
@@ -3293,47 +3354,90 @@ double History::hardRenScale(const Event& event) {
 vector<double> History::doTrialShower( PartonLevel* trial, int type,
   double maxscaleIn, double minscaleIn ) {
 
+  // Use the result of a trial shower worker, if available.
+  if ( minscaleIn <= 0. && !trialShowerWeightsSave.empty() ) {
+    map< pair<int,double>, vector<double> >::iterator it
+      = trialShowerWeightsSave.find( make_pair(type, maxscaleIn) );
+    if ( it != trialShowerWeightsSave.end() ) return it->second;
+  }
+
+  // Otherwise perform the trial shower with the objects of this instance.
+  TrialShowerWorker worker( trial, infoPtr, mergingHooksPtr,
+    particleDataPtr);
+  return doTrialShower( worker, type, maxscaleIn, minscaleIn);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Perform a trial shower with the trial shower, information and merging
+// hooks of a trial shower worker, which can be those of this instance.
+
+vector<double> History::doTrialShower( TrialShowerWorker& worker, int type,
+  double maxscaleIn, double minscaleIn ) {
+
+  // Objects used for the trial shower.
+  PartonLevel*    trial         = worker.trialPtr;
+  Info*           trialInfoPtr  = worker.infoPtr;
+  MergingHooksPtr trialHooksPtr = worker.mergingHooksPtr;
+
   // Copy state to local process
   Event process        = state;
+  if ( worker.particleDataPtr != particleDataPtr ) {
+    process.init( "(hard process-modified)", worker.particleDataPtr);
+    process.restorePtrs();
+  }
   // Set starting scale.
   double startingScale = maxscaleIn;
   // Careful when setting shower starting scale for pure QCD and prompt
   // photon case.
-  if ( mergingHooksPtr->getNumberOfClusteringSteps(process) == 0
-    && ( mergingHooksPtr->getProcessString().compare("pp>jj") == 0
-         || mergingHooksPtr->getProcessString().compare("pp>aj") == 0
+  if ( trialHooksPtr->getNumberOfClusteringSteps(process) == 0
+    && ( trialHooksPtr->getProcessString().compare("pp>jj") == 0
+         || trialHooksPtr->getProcessString().compare("pp>aj") == 0
          || isQCD2to2(state) ) )
       startingScale = min( startingScale, hardFacScale(process) );
 
-  int nWgts = mergingHooksPtr->nWgts;
+  int nWgts = trialHooksPtr->nWgts;
 
   // Set output.
   bool doVeto          = false;
   bool canEnhanceTrial = trial->canEnhanceTrial();
 
   // Save shower weight vector before variation
-  vector<double> showerWeightVecSave = infoPtr->
+  vector<double> showerWeightVecSave = trialInfoPtr->
     weightContainerPtr->weightsSimpleShower.weightValues;
   // Set shower weights to 1.
-  for (double &showerwt: infoPtr->weightContainerPtr
+  for (double &showerwt: trialInfoPtr->weightContainerPtr
          ->weightsSimpleShower.weightValues)
     showerwt = 1.;
   // Get vector of shower weights, now just vector of 1. of correct length
   vector<double> wt( nWgts, 1.);
 
+  // Construct event to be showered once, and keep an empty copy of it.
+  // Each trial emission then starts from this copy, reusing the memory
+  // of the event record rather than building a new one.
+  Event event;
+  event.init("(hard process-modified)", worker.particleDataPtr);
+  event.clear();
+  Event eventEmpty;
+  event.saveCheckpoint(eventEmpty);
+
+  // The z value at which the current state was formed does not change
+  // between trial emissions. It is only found once an emission is tried.
+  double z    = 0.5;
+  bool   hasZ = false;
+
   while (true) {
 
     // Reset trialShower object
     trial->resetTrial();
     // Set shower weights to 1. for each enhanced emission
     if (canEnhanceTrial)
-      for (double &showerwt: infoPtr->weightContainerPtr
+      for (double &showerwt: trialInfoPtr->weightContainerPtr
              ->weightsSimpleShower.weightValues)
         showerwt = 1.;
-    // Construct event to be showered
-    Event event = Event();
-    event.init("(hard process-modified)", particleDataPtr);
-    event.clear();
+    // Reset event to be showered.
+    event.restoreCheckpoint(eventEmpty);
 
     // Reset process scale so that shower starting scale is correctly set.
     process.scale(startingScale);
@@ -3347,25 +3451,27 @@ vector<double> History::doTrialShower( PartonLevel* trial, int type,
     // do not generate Sudakov
     if (minScale >= startingScale) break;
 
-    // Find z and pT values at which the current state was formed, to
-    // ensure that the showers can order the next emission correctly in
-    // rapidity, if required.
+    // Find z value at which the current state was formed, to ensure that
+    // the showers can order the next emission correctly in rapidity, if
+    // required.
     // NOT CORRECTLY SET FOR HIGHEST MULTIPLICITY STATE!
-    double z = ( mergingHooksPtr->getNumberOfClusteringSteps(state) == 0
-               || !mother )
-             ? 0.5
-             : mother->getCurrentZ(clusterIn.emittor,clusterIn.recoiler,
-                 clusterIn.emitted, clusterIn.flavRadBef);
+    if (!hasZ) {
+      if ( trialHooksPtr->getNumberOfClusteringSteps(state) != 0
+        && mother ) z = mother->getCurrentZ(clusterIn.emittor,
+          clusterIn.recoiler, clusterIn.emitted, clusterIn.flavRadBef);
+      hasZ = true;
+    }
+
     // Store z and pT values at which the current state was formed.
-    infoPtr->zNowISR(z);
-    infoPtr->pT2NowISR(pow(startingScale,2));
-    infoPtr->hasHistory(true);
+    trialInfoPtr->zNowISR(z);
+    trialInfoPtr->pT2NowISR(pow(startingScale,2));
+    trialInfoPtr->hasHistory(true);
 
     // Setup weak shower settings.
-    if (mergingHooksPtr->doWeakClustering()) setupSimpleWeakShower(0);
+    if (trialHooksPtr->doWeakClustering()) setupSimpleWeakShower(0);
 
     // Make sure trial shower stops where it should
-    mergingHooksPtr->setShowerStoppingScale(minScale);
+    trialHooksPtr->setShowerStoppingScale(minScale);
     // Perform trial shower emission
     trial->next(process,event);
     // Get trial shower pT.
@@ -3381,9 +3487,9 @@ vector<double> History::doTrialShower( PartonLevel* trial, int type,
     if ( canEnhanceTrial && pTEnhanced > 0.) pTtrial = pTEnhanced;
 
     // Get veto (merging) scale value
-    double vetoScale  = (mother) ? 0. : mergingHooksPtr->tms();
+    double vetoScale  = (mother) ? 0. : trialHooksPtr->tms();
     // Get merging scale in current event
-    double tnow = mergingHooksPtr->tmsNow( event );
+    double tnow = trialHooksPtr->tmsNow( event );
 
     // Done if evolution scale has fallen below minimum
     if ( pTtrial < minScale ) break;
@@ -3394,8 +3500,8 @@ vector<double> History::doTrialShower( PartonLevel* trial, int type,
     if ( tnow < vetoScale && vetoScale > 0. ) continue;
 
     // Retry if the trial emission was not allowed.
-    if ( mergingHooksPtr->canVetoTrialEmission()
-      && mergingHooksPtr->doVetoTrialEmission( process, event) ) continue;
+    if ( trialHooksPtr->canVetoTrialEmission()
+      && trialHooksPtr->doVetoTrialEmission( process, event) ) continue;
 
     int iRecAft = event.size() - 1;
     int iEmt    = event.size() - 2;
@@ -3419,7 +3525,7 @@ vector<double> History::doTrialShower( PartonLevel* trial, int type,
     // Update enhanced trial shower weight. (1.-1./wtEnhanced) usual veto
     // factor, only variation factor applied in shower
     if (canEnhanceTrial && pTtrial > minScale) {
-      vector<double> showerVar = infoPtr->weightContainerPtr->
+      vector<double> showerVar = trialInfoPtr->weightContainerPtr->
         weightsSimpleShower.getMuRWeightVector();
       wt[0] *= (1.-1./wtEnhanced);
       for (int i = 1; i < nWgts; ++i) wt[i] *= (1. - showerVar[i]/wtEnhanced);
@@ -3441,13 +3547,13 @@ vector<double> History::doTrialShower( PartonLevel* trial, int type,
     // above the kinematical pT of the 2 -> 2 state.
     if ( type == -1
       && typeTrial == 1
-      && mergingHooksPtr->getNumberOfClusteringSteps(process) == 0
-      && ( mergingHooksPtr->getProcessString().compare("pp>jj") == 0
-        || mergingHooksPtr->getProcessString().compare("pp>aj") == 0
+      && trialHooksPtr->getNumberOfClusteringSteps(process) == 0
+      && ( trialHooksPtr->getProcessString().compare("pp>jj") == 0
+        || trialHooksPtr->getProcessString().compare("pp>aj") == 0
            || isQCD2to2(state))
       && pTtrial > hardFacScale(process) ) {
       // Reset shower weights
-      infoPtr->weightContainerPtr->weightsSimpleShower.weightValues =
+      trialInfoPtr->weightContainerPtr->weightsSimpleShower.weightValues =
         showerWeightVecSave;
       return vector<double>( nWgts, 0.0 );
     }
@@ -3462,7 +3568,7 @@ vector<double> History::doTrialShower( PartonLevel* trial, int type,
 
   // Get combination of shower weights for muR variation in FSR and ISR
   vector<double> trialShowerWt =
-    infoPtr->weightContainerPtr->weightsSimpleShower.getMuRWeightVector();
+    trialInfoPtr->weightContainerPtr->weightsSimpleShower.getMuRWeightVector();
 
   // If not enhanced, apply veto to weights accumulated in shower
   if (!canEnhanceTrial) {
@@ -3474,7 +3580,7 @@ vector<double> History::doTrialShower( PartonLevel* trial, int type,
   if (type == -1)
     for (size_t i = 1; i < wt.size(); ++i) wt[i] = wt[0];
   // Reset shower weights
-  infoPtr->weightContainerPtr->weightsSimpleShower.weightValues =
+  trialInfoPtr->weightContainerPtr->weightsSimpleShower.weightValues =
     showerWeightVecSave;
 
   return wt;
@@ -3483,6 +3589,62 @@ vector<double> History::doTrialShower( PartonLevel* trial, int type,
 
 //--------------------------------------------------------------------------
 
+// Perform the trial showers of the path from this node to the initial node,
+// as needed in weightTree and weightTreeEmissions, on the trial shower
+// workers. Worker i performs trial showers i, i + nWorkers, ... in turn,
+// with its own random number generator, so that the results do not depend
+// on the scheduling of the threads. The results are stored in the nodes
+// and picked up by doTrialShower.
+
+void History::doTrialShowers(vector<TrialShowerWorker>& workers,
+  double maxscale) {
+
+  // Collect the trial showers, with the starting scale of each node given
+  // by the scale of its daughter.
+  bool doMPI  = mergingHooksPtr->settingsPtr->flag("PartonLevel:MPI");
+  int nMinMPI = mergingHooksPtr->nMinMPI();
+  vector<History*> nodes;
+  vector<int>      types;
+  vector<double>   maxscales;
+  for (History* node = this; node->mother; node = node->mother) {
+    if (node->state.size() >= 3) {
+      nodes.push_back(node);
+      types.push_back(1);
+      maxscales.push_back(maxscale);
+      if ( doMPI
+        && mergingHooksPtr->getNumberOfClusteringSteps(node->state)
+           < nMinMPI ) {
+        nodes.push_back(node);
+        types.push_back(-1);
+        maxscales.push_back(maxscale);
+      }
+    }
+    maxscale = node->scale;
+  }
+  int nShowers = nodes.size();
+  int nWorkers = workers.size();
+  if (nShowers == 0) return;
+
+  // Run the trial showers, one thread per worker.
+  vector< vector<double> > results(nShowers);
+  vector<thread> threads;
+  for (int iWorker = 0; iWorker < min(nWorkers, nShowers); ++iWorker)
+    threads.push_back( thread( [&, iWorker]() {
+      for (int i = iWorker; i < nShowers; i += nWorkers)
+        results[i] = nodes[i]->doTrialShower( workers[iWorker], types[i],
+          maxscales[i], 0.);
+    } ) );
+  for (thread& th : threads) th.join();
+
+  // Store the results in the nodes.
+  for (int i = 0; i < nShowers; ++i)
+    nodes[i]->trialShowerWeightsSave[ make_pair(types[i], maxscales[i]) ]
+      = results[i];
+
+}
+
+//--------------------------------------------------------------------------
+
 // Assume we have a vector of i elements containing indices into
 // another vector with N elements. Update the indices so that all
 // unique combinations (starting from 0,1,2,3, ...) are
@@ -3531,16 +3693,26 @@ vector<double> History::countEmissions(PartonLevel* trial, double maxscale,
   vector<double> showerWeightVecSave = infoPtr->
     weightContainerPtr->weightsSimpleShower.weightValues;
 
+  // Construct event to be showered once, and keep an empty copy of it.
+  Event event;
+  event.init("(hard process-modified)", particleDataPtr);
+  event.clear();
+  Event eventEmpty;
+  event.saveCheckpoint(eventEmpty);
+
+  // The z value at which the current state was formed does not change
+  // between trial emissions. It is only found once an emission is tried.
+  double z    = 0.5;
+  bool   hasZ = false;
+
   while ( true ) {
     // Reset trialShower object
     trial->resetTrial();
     // Set shower weights to 1.
     for (double &wt: infoPtr->weightContainerPtr
            ->weightsSimpleShower.weightValues) wt = 1.;
-    // Construct event to be showered
-    Event event = Event();
-    event.init("(hard process-modified)", particleDataPtr);
-    event.clear();
+    // Reset event to be showered.
+    event.restoreCheckpoint(eventEmpty);
 
     // Reset process scale
     process.scale(startingScale);
@@ -3550,15 +3722,18 @@ vector<double> History::countEmissions(PartonLevel* trial, double maxscale,
     // do not generate Sudakov
     if (minscale >= startingScale) return result;
 
-    // Find z and pT values at which the current state was formed, to
-    // ensure that the showers can order the next emission correctly in
-    // rapidity, if required
+    // Find z value at which the current state was formed, to ensure that
+    // the showers can order the next emission correctly in rapidity, if
+    // required.
+    if (!hasZ) {
+      if ( mother && mergingHooksPtr->getNumberOfClusteringSteps(state) != 0)
+        z = mother->getCurrentZ(clusterIn.emittor, clusterIn.recoiler,
+          clusterIn.emitted);
+      hasZ = true;
+    }
+
+    // Store z and pT values at which the current state was formed.
     if ( mother ) {
-      double z = ( mergingHooksPtr->getNumberOfClusteringSteps(state) == 0)
-               ? 0.5
-               : mother->getCurrentZ(clusterIn.emittor,clusterIn.recoiler,
-                   clusterIn.emitted);
-      // Store z and pT values at which the current state was formed
       infoPtr->zNowISR(z);
       infoPtr->pT2NowISR(pow(startingScale,2));
       infoPtr->hasHistory(true);
@@ -4136,8 +4311,8 @@ void History::attachClusterings (vector<Clustering>& clus, int iEmt, int iRad,
 
 vector<Clustering> History::findQCDTriple (int EmtTagIn, int colTopIn,
                       const Event& event,
-                      vector<int> posFinalPartn,
-                      vector <int> posInitPartn ) {
+                      const vector<int>& posFinalPartn,
+                      const vector<int>& posInitPartn ) {
 
   // Copy input parton tag
   int EmtTag = EmtTagIn;
@@ -4544,7 +4719,8 @@ vector<Clustering> History::getEWClusterings( const Event& event) {
 // OUT vector of all allowed radiator+recoiler+emitted triples
 
 vector<Clustering> History::findEWTripleW ( int emtTagIn, const Event& event,
-                     vector<int> posFinalPartn, vector<int> posInitPartn ) {
+                     const vector<int>& posFinalPartn,
+                     const vector<int>& posInitPartn ) {
   // Copy input parton tag
   int emtTag = emtTagIn;
   int flavEmt = event[emtTag].id();
@@ -4701,7 +4877,8 @@ vector<Clustering> History::findEWTripleW ( int emtTagIn, const Event& event,
 // OUT vector of all allowed radiator+recoiler+emitted triples
 
 vector<Clustering> History::findEWTripleZ ( int emtTagIn, const Event& event,
-                     vector<int> posFinalPartn, vector<int> posInitPartn ) {
+                     const vector<int>& posFinalPartn,
+                     const vector<int>& posInitPartn ) {
   // Copy input parton tag
   int emtTag = emtTagIn;
 
@@ -4944,8 +5121,8 @@ vector<Clustering> History::getSQCDClusterings( const Event& event) {
 
 vector<Clustering> History::findSQCDTriple (int EmtTagIn, int colTopIn,
                       const Event& event,
-                      vector<int> posFinalPartn,
-                      vector <int> posInitPartn ) {
+                      const vector<int>& posFinalPartn,
+                      const vector<int>& posInitPartn ) {
 
   // Copy input parton tag
   int EmtTag = EmtTagIn;
@@ -6755,6 +6932,98 @@ Event History::cluster( Clustering & inSystem ) {
 
 //--------------------------------------------------------------------------
 
+// Find the canonical ordering of the current state, where the final-state
+// particles are sorted by their properties, and a key that identifies
+// the state independently of the order of the final-state particles.
+// The key only contains what the search for clusterings depends on, i.e.
+// not the scales, and colour tags up to a renumbering.
+// OUT vector<double> : Key of the state
+//     vector<int>    : Canonical position of each particle in the state
+//     vector<int>    : Position in the state for each canonical position
+//     bool           : False if the state cannot be shared
+
+bool History::canonicalState( vector<double>& key, vector<int>& iCanon,
+  vector<int>& iInState) {
+
+  // Junctions are not part of the key, so never share states with them.
+  if ( state.sizeJunction() > 0 ) return false;
+
+  // Sort the final-state particles by their properties. All other
+  // particles keep their positions in the state.
+  int nState = state.size();
+  vector<int> iFinal;
+  for (int i = 0; i < nState; ++i)
+    if ( state[i].isFinal() ) iFinal.push_back(i);
+  vector<int> iSorted(iFinal);
+  const Event& event = state;
+  sort( iSorted.begin(), iSorted.end(), [&](int i, int j) {
+    const Particle& a = event[i];
+    const Particle& b = event[j];
+    if ( a.id()  != b.id()  ) return a.id()  < b.id();
+    if ( a.px()  != b.px()  ) return a.px()  < b.px();
+    if ( a.py()  != b.py()  ) return a.py()  < b.py();
+    if ( a.pz()  != b.pz()  ) return a.pz()  < b.pz();
+    if ( a.e()   != b.e()   ) return a.e()   < b.e();
+    if ( a.pol() != b.pol() ) return a.pol() < b.pol();
+    return i < j; } );
+
+  // Positions in the canonical ordering.
+  iInState.resize(nState);
+  iCanon.resize(nState);
+  for (int i = 0; i < nState; ++i) iInState[i] = i;
+  for (int i = 0; i < int(iFinal.size()); ++i)
+    iInState[iFinal[i]] = iSorted[i];
+  for (int i = 0; i < nState; ++i) iCanon[iInState[i]] = i;
+
+  // Colour tags depend on the order of the clusterings, so number them
+  // by their first appearance in the canonical ordering.
+  vector<int> colTags(1, 0);
+  vector<int> colCanon(2 * nState);
+  for (int i = 0; i < 2 * nState; ++i) {
+    const Particle& p = state[iInState[i/2]];
+    int tag = (i%2 == 0) ? p.col() : p.acol();
+    int iTag = 0;
+    while ( iTag < int(colTags.size()) && colTags[iTag] != tag ) ++iTag;
+    if ( iTag == int(colTags.size()) ) colTags.push_back(tag);
+    colCanon[i] = iTag;
+  }
+
+  // Store all properties of the particles in canonical order, final-state
+  // particles first and momenta first, so that keys of different states
+  // quickly differ. Mothers, and daughters of intermediate resonances,
+  // point to single particles and are translated to canonical positions.
+  // The daughters of the incoming partons give a range and are kept as
+  // they are.
+  key.resize(0);
+  key.reserve(14 * nState + 1);
+  for (int iLoop = 0; iLoop < 2 * nState; ++iLoop) {
+    int i = iLoop % nState;
+    const Particle& p = state[iInState[i]];
+    if ( p.isFinal() != (iLoop < nState) ) continue;
+    int mot1 = (p.mother1() > 0 && p.mother1() < nState)
+             ? iCanon[p.mother1()] : p.mother1();
+    int mot2 = (p.mother2() > 0 && p.mother2() < nState)
+             ? iCanon[p.mother2()] : p.mother2();
+    int dau1 = p.daughter1();
+    int dau2 = p.daughter2();
+    if ( p.status() == -22 ) {
+      if ( dau1 > 0 && dau1 < nState ) dau1 = iCanon[dau1];
+      if ( dau2 > 0 && dau2 < nState ) dau2 = iCanon[dau2];
+    }
+    double prop[] = { p.px(), p.py(), p.pz(), p.e(), p.m(), double(p.id()),
+      double(p.status()), double(mot1), double(mot2), double(dau1),
+      double(dau2), double(colCanon[2*i]), double(colCanon[2*i+1]),
+      p.pol() };
+    key.insert( key.end(), prop, prop + 14);
+  }
+
+  // Done
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
 // Function to get the flavour of the radiator before the splitting
 // for clustering
 // IN int  : Flavour of the radiator after the splitting
@@ -8,6 +8,9 @@
 // Function definitions.
 
 #include "Pythia8/LHEF3.h"
+#include <time.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace Pythia8 {
 
@@ -702,9 +705,49 @@ bool Reader::init() {
 // Read an event from the file and store it in the hepeup
 // object. Optional comment lines are stored in the eventComments
 // member variable. return true if the read was successful.
+// Also keep track of the number of events and CPU time for statistics.
 
 bool Reader::readEvent(HEPEUP * peup) {
 
+  clock_t start = clock();
+  bool isRead = parseEvent(peup);
+  timeReadSave += double(clock() - start) / CLOCKS_PER_SEC;
+  if (isRead) ++nEventsRead;
+  return isRead;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Hand-written tokenizers for the numbers on event lines, which avoid
+// setting up an istringstream for each line. Each call reads the next
+// white-space separated number, and moves the pointer past it.
+
+template<typename T> static bool readInt(const char*& p, T& val) {
+  char* pEnd;
+  long valNow = strtol(p, &pEnd, 10);
+  if (pEnd == p) return false;
+  val = T(valNow);
+  p = pEnd;
+  return true;
+}
+
+static bool readDouble(const char*& p, double& val) {
+  char* pEnd;
+  double valNow = strtod(p, &pEnd);
+  if (pEnd == p) return false;
+  val = valNow;
+  p = pEnd;
+  return true;
+}
+
+//--------------------------------------------------------------------------
+
+// Read and parse an event. The HEPEUP vectors keep their capacity
+// between events, so normally no memory is allocated.
+
+bool Reader::parseEvent(HEPEUP * peup) {
+
   HEPEUP & eup = (peup? *peup: hepeup);
   eup.clear();
   eup.heprup = &heprup;
@@ -724,8 +767,10 @@ bool Reader::readEvent(HEPEUP * peup) {
   while ( getLine() && currentLine.find("<event") == string::npos )
     outsideBlock += currentLine + "\n";
 
-  // Get event attributes.
-  if (currentLine != "") {
+  // Get event attributes. The XML parsing is only needed if there are any.
+  size_t iEvt = currentLine.find("<event");
+  if (currentLine != ""
+    && currentLine.find('=', iEvt) < currentLine.find('>', iEvt)) {
     string eventLine(currentLine);
     eventLine += "</event>";
     vector<XMLTag*> evtags = XMLTag::findXMLTags(eventLine);
@@ -742,22 +787,26 @@ bool Reader::readEvent(HEPEUP * peup) {
 
   // We found an event. The first line determines how many
   // subsequent particle lines we have.
-  istringstream iss(currentLine);
-  if ( !( iss >> eup.NUP >> eup.IDPRUP >> eup.XWGTUP
-              >> eup.SCALUP >> eup.AQEDUP >> eup.AQCDUP ) )
+  const char* pNow = currentLine.c_str();
+  if ( !( readInt(pNow, eup.NUP) && readInt(pNow, eup.IDPRUP)
+       && readDouble(pNow, eup.XWGTUP) && readDouble(pNow, eup.SCALUP)
+       && readDouble(pNow, eup.AQEDUP) && readDouble(pNow, eup.AQCDUP) ) )
     return false;
   eup.resize();
 
   // Read all particle lines.
   for ( int i = 0; i < eup.NUP; ++i ) {
     if ( !getLine() ) return false;
-    istringstream isss(currentLine);
-    if ( !( isss >> eup.IDUP[i] >> eup.ISTUP[i]
-                >> eup.MOTHUP[i].first >> eup.MOTHUP[i].second
-                >> eup.ICOLUP[i].first >> eup.ICOLUP[i].second
-                >> eup.PUP[i][0] >> eup.PUP[i][1] >> eup.PUP[i][2]
-                >> eup.PUP[i][3] >> eup.PUP[i][4]
-                >> eup.VTIMUP[i] >> eup.SPINUP[i] ) )
+    pNow = currentLine.c_str();
+    if ( !( readInt(pNow, eup.IDUP[i]) && readInt(pNow, eup.ISTUP[i])
+         && readInt(pNow, eup.MOTHUP[i].first)
+         && readInt(pNow, eup.MOTHUP[i].second)
+         && readInt(pNow, eup.ICOLUP[i].first)
+         && readInt(pNow, eup.ICOLUP[i].second)
+         && readDouble(pNow, eup.PUP[i][0]) && readDouble(pNow, eup.PUP[i][1])
+         && readDouble(pNow, eup.PUP[i][2]) && readDouble(pNow, eup.PUP[i][3])
+         && readDouble(pNow, eup.PUP[i][4]) && readDouble(pNow, eup.VTIMUP[i])
+         && readDouble(pNow, eup.SPINUP[i]) ) )
       return false;
   }
 
@@ -769,9 +818,11 @@ bool Reader::readEvent(HEPEUP * peup) {
 
   eup.scalesSave = LHAscales(eup.SCALUP);
 
-  // Scan the init block for XML tags
+  // Scan the init block for XML tags. Without any, all is leftovers.
   string leftovers;
-  vector<XMLTag*> tags = XMLTag::findXMLTags(eventComments, &leftovers);
+  vector<XMLTag*> tags;
+  if (eventComments.find('<') == string::npos) leftovers = eventComments;
+  else tags = XMLTag::findXMLTags(eventComments, &leftovers);
   if ( leftovers.find_first_not_of(" \t\n") == string::npos )
     leftovers="";
 
@@ -834,6 +885,135 @@ bool Reader::readEvent(HEPEUP * peup) {
 
 }
 
+//--------------------------------------------------------------------------
+
+// Skip a number of events by only looking for the event tags.
+
+bool Reader::skipEvents(int nSkip) {
+
+  for (int iSkip = 0; iSkip < nSkip; ++iSkip) {
+    while ( getLine() && currentLine.find("<event") == string::npos ) {}
+    if ( currentLine == "" ) return false;
+    while ( getLine() && currentLine.find("</event>") == string::npos ) {}
+    if ( currentLine == "" ) return false;
+  }
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Set up an index of event byte offsets, from a sidecar file or a scan.
+
+bool Reader::setupIndex(bool saveIndex) {
+
+  if ( hasIndex ) return true;
+  if ( filename == "" ) return false;
+  string indexFile = filename + ".idx";
+  string pointFile = filename + ".zidx";
+
+  // Size and modification time of the file, to check that an existing
+  // index file belongs to it.
+  struct stat fileStat;
+  if ( ::stat(filename.c_str(), &fileStat) != 0 ) return false;
+  long long fileSize = fileStat.st_size;
+  long long fileTime = fileStat.st_mtime;
+
+  // Try to read an existing index file. The first line gives the
+  // number of events, which must match the number of offsets, and the
+  // size and modification time of the file it was made for.
+  ifstream isIndex(indexFile.c_str());
+  string tag;
+  long nEvents = -1;
+  long long sizeIndex = -1, timeIndex = -1;
+  if ( isIndex >> tag >> nEvents >> sizeIndex >> timeIndex
+    && tag == "LHEFindex" && nEvents >= 0 && sizeIndex == fileSize
+    && timeIndex == fileTime ) {
+    long long offset;
+    while ( isIndex >> offset ) eventOffsets.push_back(offset);
+    if ( long(eventOffsets.size()) == nEvents ) {
+      hasIndex = true;
+#ifdef GZIP
+      // Also the decompression access points of a gzipped file, if any.
+      if ( intstream ) intstream->rdbuf()->read_access_points(
+        pointFile.c_str());
+#endif
+      return true;
+    }
+    eventOffsets.clear();
+  }
+
+  // Else scan the file, summing up the lengths of lines (including the
+  // stripped newline) after the init block to get the event offsets.
+  // For a gzipped file, record points where decompression can restart
+  // in the same pass, so that the later seeks need not decompress the
+  // file from the start.
+  igzstream isScan(filename.c_str());
+  if ( !isScan.good() ) return false;
+#ifdef GZIP
+  isScan.rdbuf()->record_access_points();
+#endif
+  string line;
+  long long offset = 0;
+  bool afterInit = false;
+  while ( getline(isScan, line) ) {
+    if ( afterInit && line.find("<event") != string::npos )
+      eventOffsets.push_back(offset);
+    else if ( !afterInit && line.find("</init>") != string::npos )
+      afterInit = true;
+    offset += line.size() + 1;
+  }
+  hasIndex = true;
+#ifdef GZIP
+  if ( intstream ) intstream->rdbuf()->copy_access_points(*isScan.rdbuf());
+#endif
+
+  // Optionally save the index, via a temporary file renamed when complete,
+  // so that other jobs never see an incomplete index file. The access
+  // points are saved first, so they are in place when the index is.
+  // The process id keeps the names of temporary files apart for jobs
+  // reading the same file in parallel.
+  if ( saveIndex ) {
+    string tmpFile = indexFile + ".tmp" + to_string(long(getpid())) + "_"
+      + to_string(size_t(this));
+#ifdef GZIP
+    if ( isScan.rdbuf()->n_access_points() > 0 ) {
+      if ( !isScan.rdbuf()->write_access_points(tmpFile.c_str())
+        || rename(tmpFile.c_str(), pointFile.c_str()) != 0 )
+        remove(tmpFile.c_str());
+    }
+#endif
+    ofstream osIndex(tmpFile.c_str());
+    osIndex << "LHEFindex " << eventOffsets.size() << " " << fileSize
+            << " " << fileTime << "\n";
+    for ( int i = 0, N = eventOffsets.size(); i < N; ++i )
+      osIndex << eventOffsets[i] << "\n";
+    osIndex.close();
+    if ( !osIndex || rename(tmpFile.c_str(), indexFile.c_str()) != 0 )
+      remove(tmpFile.c_str());
+  }
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Move to the start of an event using the index. Check that there
+// is an event tag at that position, and then move back to it.
+
+bool Reader::seekEvent(long iEvent) {
+
+  if ( !hasIndex || iEvent < 0 || iEvent >= long(eventOffsets.size()) )
+    return false;
+  file->clear();
+  if ( !file->seekg(eventOffsets[iEvent]) ) return false;
+  if ( !getline(*file, currentLine)
+    || currentLine.find("<event") == string::npos ) return false;
+  file->seekg(eventOffsets[iEvent]);
+  return bool(*file);
+
+}
+
 //==========================================================================
 
 // The Writer class is initialized with a stream to which to write a
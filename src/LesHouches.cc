@@ -1071,6 +1071,79 @@ bool LHAupLHEF::setNewEventLHEF() {
 
 }
 
+//--------------------------------------------------------------------------
+
+// Skip ahead a number of events, which are not considered further.
+// Either read them in full, scan for the event tags, or jump directly
+// to the next event to be read, using an index of event positions.
+
+bool LHAupLHEF::skipEvent(int nSkip) {
+
+  // Not possible to skip beyond the end of the requested range.
+  if (nSkip <= 0) return true;
+  if (nLast >= 0 && iEventNow + nSkip > nLast) {
+    iEventNow = nLast;
+    return false;
+  }
+  int iEventOld = iEventNow;
+  iEventNow += nSkip;
+
+  // Use index, with a fast scan as fallback if no index is available.
+  if (indexMode == 2 && reader.setupIndex()) {
+    if (iEventNow >= reader.nIndexed()) return false;
+    if (reader.seekEvent(iEventNow)) return true;
+    infoPtr->errorMsg("Warning in LHAupLHEF::skipEvent: "
+      "event index does not match file, using a scan of the file instead");
+    if (!reader.seekEvent(iEventOld)) return false;
+  }
+  if (indexMode > 0) return reader.skipEvents(nSkip);
+
+  // Default: read and parse the events.
+  for (int iSkip = 0; iSkip < nSkip; ++iSkip)
+    if (!setNewEventLHEF()) return false;
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Print statistics on the reading of events, in MB and events per second
+// of CPU time spent on reading and parsing them.
+
+void LHAupLHEF::stat() {
+
+  // Save output format, to be restored at the end.
+  ios::fmtflags flagsSave = cout.flags();
+  int precisionSave       = cout.precision();
+
+  long   nRead    = reader.nRead();
+  double mbRead   = 1e-6 * reader.bytesRead();
+  double timeRead = reader.timeRead();
+  cout << "\n *-------  PYTHIA LHEF Reading Statistics  ----------*\n"
+       << " |                                                   |\n"
+       << " | " << left << setw(34) << "Number of events read" << right
+       << setw(15) << nRead << " |\n"
+       << fixed << setprecision(1)
+       << " | " << left << setw(34) << "Uncompressed size read (MB)" << right
+       << setw(15) << mbRead << " |\n"
+       << setprecision(3)
+       << " | " << left << setw(34) << "CPU time for reading (s)" << right
+       << setw(15) << timeRead << " |\n"
+       << setprecision(1)
+       << " | " << left << setw(34) << "Reading speed (MB/s)" << right
+       << setw(15) << ((timeRead > 0.) ? mbRead / timeRead : 0.) << " |\n"
+       << " | " << left << setw(34) << "Reading speed (events/s)" << right
+       << setw(15) << ((timeRead > 0.) ? double(nRead) / timeRead : 0.)
+       << " |\n"
+       << " |                                                   |\n"
+       << " *-------  End PYTHIA LHEF Reading Statistics  ------*" << endl;
+
+  // Restore output format.
+  cout.flags(flagsSave);
+  cout.precision(precisionSave);
+
+}
+
 //==========================================================================
 
 // LHAupPlugin class.
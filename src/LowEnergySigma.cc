@@ -332,14 +332,44 @@ void LowEnergySigma::init(NucleonExcitations* nucleonExcitationsPtrIn) {
   // Store pointer
   nucleonExcitationsPtr = nucleonExcitationsPtrIn;
 
+  // Cross section tables, filled when needed.
+  useTables      = flag("LowEnergyQCD:useSigmaTables");
+  checkTables    = flag("LowEnergyQCD:checkSigmaTables");
+  tableStep      = parm("LowEnergyQCD:sigmaTableStep");
+  tableRange     = parm("LowEnergyQCD:sigmaTableRange");
+  tableTolerance = parm("LowEnergyQCD:sigmaTableTolerance");
+  sigmaTables.clear();
+
 }
 
 //--------------------------------------------------------------------------
 
-// Get the total cross section for the specified collision
+// Get the total cross section for the specified collision, from tables
+// if they are used.
 
 double LowEnergySigma::sigmaTotal(int idAIn, int idBIn, double eCMIn,
   double mAIn, double mBIn) {
+  return (useTables) ? sigmaTab(idAIn, idBIn, eCMIn, mAIn, mBIn, 0)
+                     : sigmaTotalCalc(idAIn, idBIn, eCMIn, mAIn, mBIn);
+}
+
+//--------------------------------------------------------------------------
+
+// Get the partial cross section for the specified process, from tables
+// if they are used.
+
+double LowEnergySigma::sigmaPartial(int idAIn, int idBIn, double eCMIn,
+  double mAIn, double mBIn, int proc) {
+  return (useTables) ? sigmaTab(idAIn, idBIn, eCMIn, mAIn, mBIn, proc)
+                     : sigmaPartialCalc(idAIn, idBIn, eCMIn, mAIn, mBIn, proc);
+}
+
+//--------------------------------------------------------------------------
+
+// Get the total cross section for the specified collision.
+
+double LowEnergySigma::sigmaTotalCalc(int idAIn, int idBIn, double eCMIn,
+  double mAIn, double mBIn) {
 
   // Energy cannot be less than the hadron masses.
   if (eCMIn <= mAIn + mBIn) {
@@ -351,11 +381,11 @@ double LowEnergySigma::sigmaTotal(int idAIn, int idBIn, double eCMIn,
 
   // For K0S/K0L, take average of K0 and K0bar.
   if (idAIn == 310 || idAIn == 130)
-    return 0.5 * (sigmaTotal( 311, idBIn, eCMIn, mAIn, mBIn)
-                + sigmaTotal(-311, idBIn, eCMIn, mAIn, mBIn));
+    return 0.5 * (sigmaTotalCalc( 311, idBIn, eCMIn, mAIn, mBIn)
+                + sigmaTotalCalc(-311, idBIn, eCMIn, mAIn, mBIn));
   if (idBIn == 310 || idBIn == 130)
-    return 0.5 * (sigmaTotal(idAIn,  311, eCMIn, mAIn, mBIn)
-                + sigmaTotal(idAIn, -311, eCMIn, mAIn, mBIn));
+    return 0.5 * (sigmaTotalCalc(idAIn,  311, eCMIn, mAIn, mBIn)
+                + sigmaTotalCalc(idAIn, -311, eCMIn, mAIn, mBIn));
 
   // Fix particle ordering.
   setConfig(idAIn, idBIn, eCMIn, mAIn, mBIn);
@@ -388,8 +418,8 @@ double LowEnergySigma::sigmaTotal(int idAIn, int idBIn, double eCMIn,
 
 // Gets the partial cross section for the specified process.
 
-double LowEnergySigma::sigmaPartial(int idAIn, int idBIn, double eCMIn,
-  double mAIn, double mBIn, int proc) {
+double LowEnergySigma::sigmaPartialCalc(int idAIn, int idBIn,
+  double eCMIn, double mAIn, double mBIn, int proc) {
 
   // Energy cannot be less than the hadron masses.
   if (eCMIn <= mAIn + mBIn) {
@@ -401,14 +431,14 @@ double LowEnergySigma::sigmaPartial(int idAIn, int idBIn, double eCMIn,
 
   // For K0S/K0L, take average of K0 and K0bar.
   if (idAIn == 310 || idAIn == 130)
-    return 0.5 * (sigmaPartial( 311, idBIn, eCMIn, mAIn, mBIn, proc)
-                + sigmaPartial(-311, idBIn, eCMIn, mAIn, mBIn, proc));
+    return 0.5 * (sigmaPartialCalc( 311, idBIn, eCMIn, mAIn, mBIn, proc)
+                + sigmaPartialCalc(-311, idBIn, eCMIn, mAIn, mBIn, proc));
   if (idBIn == 310 || idBIn == 130)
-    return 0.5 * (sigmaPartial(idAIn,  311, eCMIn, mAIn, mBIn, proc)
-                + sigmaPartial(idAIn, -311, eCMIn, mAIn, mBIn, proc));
+    return 0.5 * (sigmaPartialCalc(idAIn,  311, eCMIn, mAIn, mBIn, proc)
+                + sigmaPartialCalc(idAIn, -311, eCMIn, mAIn, mBIn, proc));
 
   // Total cross section.
-  if (proc == 0) return sigmaTotal(idAIn, idBIn, eCMIn, mAIn, mBIn);
+  if (proc == 0) return sigmaTotalCalc(idAIn, idBIn, eCMIn, mAIn, mBIn);
 
   // Get all partial cross sections.
   vector<int> procs;
@@ -428,6 +458,75 @@ double LowEnergySigma::sigmaPartial(int idAIn, int idBIn, double eCMIn,
 
 //--------------------------------------------------------------------------
 
+// Get the total (proc = 0) or a partial cross section from the table for
+// the incoming pair, interpolating linearly in eCM. A bin is accepted for
+// interpolation only if the interpolation agrees with direct evaluation
+// in the midpoint of the bin, within the requested tolerance.
+
+double LowEnergySigma::sigmaTab(int idAIn, int idBIn, double eCMIn,
+  double mAIn, double mBIn, int proc) {
+
+  // Direct evaluation at a given energy.
+  auto sigmaCalc = [&](double eCMNow) {
+    return (proc == 0) ? sigmaTotalCalc(idAIn, idBIn, eCMNow, mAIn, mBIn)
+      : sigmaPartialCalc(idAIn, idBIn, eCMNow, mAIn, mBIn, proc); };
+
+  // Find table for the pair and process, or else book an empty one.
+  pair<pair<int, int>, int> key = make_pair(make_pair(idAIn, idBIn), proc);
+  auto iter = sigmaTables.find(key);
+  if (iter == sigmaTables.end()) {
+    double mA0 = particleDataPtr->m0(idAIn);
+    double mB0 = particleDataPtr->m0(idBIn);
+    int nBin   = max(1, int(tableRange / tableStep));
+    SigmaTable table = { mA0, mB0, mA0 + mB0, vector<double>(nBin + 1, 0.),
+      vector<bool>(nBin + 1, false), vector<unsigned char>(nBin, 0) };
+    iter = sigmaTables.emplace(key, table).first;
+  }
+  SigmaTable& table = iter->second;
+
+  // Tables are only for nominal masses and inside the tabulated range.
+  // The bin closest to threshold is always evaluated directly.
+  double x = (eCMIn - table.eMin) / tableStep;
+  if (mAIn != table.mA || mBIn != table.mB || x < 1.
+    || x >= table.binState.size()) return sigmaCalc(eCMIn);
+  int j = int(x);
+
+  // Fill the bin the first time it is used.
+  if (table.binState[j] == 0) {
+    for (int i = j; i <= j + 1; ++i) if (!table.hasNode[i]) {
+      table.sigma[i]   = sigmaCalc(table.eMin + i * tableStep);
+      table.hasNode[i] = true;
+    }
+    double sigMid = sigmaCalc(table.eMin + (j + 0.5) * tableStep);
+    double sigAvg = 0.5 * (table.sigma[j] + table.sigma[j + 1]);
+    double sigDiff = abs(sigMid - sigAvg);
+    table.binState[j] = (sigDiff > TINYSIGMA
+      && sigDiff > tableTolerance * abs(sigMid)) ? 2 : 1;
+  }
+
+  // Evaluate directly where linear interpolation is not good enough.
+  if (table.binState[j] == 2) return sigmaCalc(eCMIn);
+  double sigma = table.sigma[j] + (x - j) * (table.sigma[j + 1]
+               - table.sigma[j]);
+
+  // Optionally compare with direct evaluation.
+  if (checkTables) {
+    double sigmaNow = sigmaCalc(eCMIn);
+    double sigDiff  = abs(sigma - sigmaNow);
+    if (sigDiff > TINYSIGMA && sigDiff > tableTolerance * abs(sigmaNow))
+      infoPtr->errorMsg("Warning in LowEnergySigma::sigmaTab: "
+      "tabulated cross section differs from direct evaluation", "for "
+      + to_string(idAIn) + " " + to_string(idBIn) + " @ "
+      + to_string(eCMIn) + " GeV, process " + to_string(proc));
+  }
+
+  // Done.
+  return sigma;
+
+}
+
+//--------------------------------------------------------------------------
+
 // Gets all partial cross sections for the specified collision.
 // Returns whether any processes have positive cross sections.
 
@@ -866,8 +965,9 @@ double LowEnergySigma::calcRes(int idR) const {
       return 0.;
   }
 
-  double gammaR = hadronWidthsPtr->width(idR, eCM);
-  double brR    = hadronWidthsPtr->br(idR, idA, idB, eCM);
+  // Total width and branching ratio from a single table lookup.
+  double gammaR;
+  double brR = hadronWidthsPtr->br(idR, idA, idB, eCM, gammaR);
 
   if (gammaR == 0. || brR == 0.)
     return 0.;
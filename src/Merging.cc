@@ -256,12 +256,20 @@ int Merging::mergeProcessCKKWL( Event& process) {
     infoPtr->errorMsg(message);
   }
 
+  // Optionally let the trial shower workers perform the trial showers.
+  vector<TrialShowerWorker>* workersPtr = nullptr;
+  if ( !trialShowerWorkers.empty() ) {
+    prepareTrialShowerWorkers( newProcess);
+    workersPtr = &trialShowerWorkers;
+  }
+
   // Calculate CKKWL weight:
   // Perform reweighting with Sudakov factors, save alpha_s ratios and
   // PDF ratio weights.
   wgt = FullHistory.weightCKKWL( trialPartonLevelPtr,
     mergingHooksPtr->AlphaS_FSR(), mergingHooksPtr->AlphaS_ISR(),
-    mergingHooksPtr->AlphaEM_FSR(), mergingHooksPtr->AlphaEM_ISR(), RN);
+    mergingHooksPtr->AlphaEM_FSR(), mergingHooksPtr->AlphaEM_ISR(), RN,
+    workersPtr);
 
   // Event with production scales set for further (trial) showering
   // and starting conditions for the shower.
@@ -314,6 +322,66 @@ int Merging::mergeProcessCKKWL( Event& process) {
 
 //--------------------------------------------------------------------------
 
+// Function to set up the trial shower workers for the current event, by
+// copying the event information and the merging state of this instance.
+
+void Merging::prepareTrialShowerWorkers( const Event& process) {
+
+  for (TrialShowerWorker& worker : trialShowerWorkers) {
+
+    // Give each worker its own random number sequence, seeded from the
+    // random number generator of this instance.
+    worker.rndmPtr->init( 1 + int( 899999999. * rndmPtr->flat() ) );
+
+    // Copy the information on the hard process.
+    Info& infoNow = *worker.infoPtr;
+    infoNow.clear();
+    infoNow.setECM( infoPtr->eCM() );
+    infoNow.setType( infoPtr->name(), infoPtr->code(), infoPtr->nFinal(),
+      infoPtr->isNonDiffractive(), infoPtr->isResolved(),
+      infoPtr->isDiffractiveA(), infoPtr->isDiffractiveB(),
+      infoPtr->isDiffractiveC(), infoPtr->isLHA() );
+    infoNow.setPDFalpha( 0, infoPtr->id1pdf(), infoPtr->id2pdf(),
+      infoPtr->x1pdf(), infoPtr->x2pdf(), infoPtr->pdf1(), infoPtr->pdf2(),
+      infoPtr->Q2Fac(), infoPtr->alphaEM(), infoPtr->alphaS(),
+      infoPtr->Q2Ren(), infoPtr->scalup() );
+    infoNow.setKin( 0, infoPtr->id1(), infoPtr->id2(), infoPtr->x1(),
+      infoPtr->x2(), infoPtr->sHat(), infoPtr->tHat(), infoPtr->uHat(),
+      infoPtr->pTHat(), infoPtr->m3Hat(), infoPtr->m4Hat(),
+      infoPtr->thetaHat(), infoPtr->phiHat() );
+    infoNow.setTypeMPI( infoPtr->code(), infoPtr->pTHat() );
+    infoNow.eventAttributes = infoPtr->eventAttributes;
+    infoNow.scales          = infoPtr->scales;
+
+    // Reinitialise the hard process and copy the merging state.
+    MergingHooksPtr hooksNow = worker.mergingHooksPtr;
+    hooksNow->hardProcess->clear();
+    hooksNow->processNow = mergingHooksPtr->processNow;
+    hooksNow->hardProcess->initOnProcess( hooksNow->processNow,
+      worker.particleDataPtr);
+    hooksNow->storeHardProcessCandidates( process);
+    hooksNow->hasJetMaxLocal        = mergingHooksPtr->hasJetMaxLocal;
+    hooksNow->nJetMaxLocal          = mergingHooksPtr->nJetMaxLocal;
+    hooksNow->nJetMaxNLOLocal       = mergingHooksPtr->nJetMaxNLOLocal;
+    hooksNow->nRequestedSave        = mergingHooksPtr->nRequestedSave;
+    hooksNow->nReclusterSave        = mergingHooksPtr->nReclusterSave;
+    hooksNow->tmsValueNow           = mergingHooksPtr->tmsValueNow;
+    hooksNow->muMISave              = mergingHooksPtr->muMISave;
+    hooksNow->doOrderHistoriesSave  = mergingHooksPtr->doOrderHistoriesSave;
+    hooksNow->doCutOnRecStateSave   = mergingHooksPtr->doCutOnRecStateSave;
+    hooksNow->doIgnoreStepSave      = mergingHooksPtr->doIgnoreStepSave;
+    hooksNow->doIgnoreEmissionsSave = mergingHooksPtr->doIgnoreEmissionsSave;
+    hooksNow->setHardProcessInfo( mergingHooksPtr->nHardNowSave,
+      mergingHooksPtr->tmsHardNowSave);
+    hooksNow->setEventVetoInfo( mergingHooksPtr->nJetNowSave,
+      mergingHooksPtr->tmsNowSave);
+
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
 // Function to perform UMEPS merging on this event.
 
 int Merging::mergeProcessUMEPS( Event& process) {
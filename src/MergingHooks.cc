@@ -2154,6 +2154,7 @@ void MergingHooks::init(){
   pickByFullPSave       = flag("Merging:pickByFullP");
   pickByPoPT2Save       = flag("Merging:pickByPoPT2");
   includeRedundantSave  = flag("Merging:includeRedundant");
+  shareHistoryStatesSave = flag("Merging:shareHistoryStates");
 
   // Parameters for scale choices
   unorderedScalePrescipSave    = mode("Merging:unorderedScalePrescrip");
@@ -1093,7 +1093,7 @@ bool PartonLevel::next( Event& process, Event& event) {
 
   // Do colour reconnection for non-diffractive events before resonance decays.
   if ( colourReconnectionPtr && !doDiffCR && reconnectMode > 0) {
-    Event eventSave = event;
+    event.saveCheckpoint( eventSave);
     bool colCorrect = false;
     for (int i = 0; i < 10; ++i) {
       colourReconnectionPtr->next(event, 0);
@@ -1101,7 +1101,7 @@ bool PartonLevel::next( Event& process, Event& event) {
         colCorrect = true;
         break;
       }
-      else event = eventSave;
+      else event.restoreCheckpoint( eventSave);
     }
     if (!colCorrect) {
       infoPtr->errorMsg("Error in PartonLevel::next: "
@@ -1139,7 +1139,7 @@ bool PartonLevel::next( Event& process, Event& event) {
   // Do colour reconnection for resonance decays.
   if (!earlyResDec && forceResonanceCR && colourReconnectionPtr &&
       !doDiffCR && reconnectMode != 0) {
-    Event eventSave = event;
+    event.saveCheckpoint( eventSave);
     bool colCorrect = false;
     for (int i = 0; i < 10; ++i) {
       colourReconnectionPtr->next(event, oldSizeEvt);
@@ -1147,7 +1147,7 @@ bool PartonLevel::next( Event& process, Event& event) {
         colCorrect = true;
         break;
       }
-      else event = eventSave;
+      else event.restoreCheckpoint( eventSave);
     }
     if (!colCorrect) {
       infoPtr->errorMsg("Error in PartonLevel::next: "
@@ -76,6 +76,9 @@ const double PhaseSpace::SHATMINZ       = 1.;
 // Regularization for small pT2min in z = cos(theta) selection.
 const double PhaseSpace::PT2RATMINZ     = 0.0001;
 
+// Fraction of total weight shared evenly between shapes when adapting.
+const double PhaseSpace::ADAPTEVENFRAC  = 0.1;
+
 // These numbers are hardwired empirical parameters,
 // intended to speed up the M-generator.
 const double PhaseSpace::WTCORRECTION[11] = { 1., 1., 1.,
@@ -183,6 +186,10 @@ void PhaseSpace::init(bool isFirst, SigmaProcess* sigmaProcessPtrIn) {
   showViolation        = flag("PhaseSpace:showViolation");
   increaseMaximum      = flag("PhaseSpace:increaseMaximum");
 
+  // Optional adaptation of phase space coefficients to sampled points.
+  nAdaptIter           = mode("PhaseSpace:nAdaptIterations");
+  nAdaptPoints         = mode("PhaseSpace:nAdaptPoints");
+
   // Know whether a Z0 is pure Z0 or admixed with gamma*.
   gmZmodeGlobal        = mode("WeakZ0:gmZmode");
 
@@ -732,18 +739,11 @@ bool PhaseSpace::setupSampling123(bool is2, bool is3) {
   if (showSearch) cout << "\n";
 
   // Provide cumulative sum of coefficients.
-  tauCoefSum[0] = tauCoef[0];
-    yCoefSum[0] =   yCoef[0];
-    zCoefSum[0] =   zCoef[0];
-  for (int i = 1; i < 8; ++ i) {
-    tauCoefSum[i] = tauCoefSum[i - 1] + tauCoef[i];
-      yCoefSum[i] =   yCoefSum[i - 1] +   yCoef[i];
-      zCoefSum[i] =   zCoefSum[i - 1] +   zCoef[i];
-  }
-  // The last element should be > 1 to be on safe side in selection below.
-  tauCoefSum[nTau - 1] = 2.;
-    yCoefSum[nY   - 1] = 2.;
-    zCoefSum[nZ   - 1] = 2.;
+  sumCoef123();
+
+  // Optionally adapt coefficients further to randomly sampled points.
+  double sigmaMxAdapt = 0.;
+  if (nAdaptIter > 0) sigmaMxAdapt = adaptSampling123(is2, is3);
 
 
   // Begin find two most promising maxima among same points as before.
@@ -973,6 +973,8 @@ bool PhaseSpace::setupSampling123(bool is2, bool is3) {
       }
     }
   }
+  // Not below the largest cross section in the adapted sampling.
+  if (sigmaMxAdapt > sigmaMx) sigmaMx = sigmaMxAdapt;
   sigmaMx *= SAFETYMARGIN;
   sigmaPos = sigmaMx;
 
@@ -986,6 +988,180 @@ bool PhaseSpace::setupSampling123(bool is2, bool is3) {
 
 //--------------------------------------------------------------------------
 
+// Provide cumulative sum of coefficients, used in the shape selection.
+
+void PhaseSpace::sumCoef123() {
+
+  tauCoefSum[0] = tauCoef[0];
+    yCoefSum[0] =   yCoef[0];
+    zCoefSum[0] =   zCoef[0];
+  for (int i = 1; i < 8; ++ i) {
+    tauCoefSum[i] = tauCoefSum[i - 1] + tauCoef[i];
+      yCoefSum[i] =   yCoefSum[i - 1] +   yCoef[i];
+      zCoefSum[i] =   zCoefSum[i - 1] +   zCoef[i];
+  }
+  // The last element should be > 1 to be on safe side in selection.
+  tauCoefSum[nTau - 1] = 2.;
+    yCoefSum[nY   - 1] = 2.;
+    zCoefSum[nZ   - 1] = 2.;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Adapt the coefficients of the tau, y and z shapes in a few iterations,
+// using the cross section in phase space points sampled as in trialKin123.
+// As in adaptive multichannel sampling, the coefficient of each shape is
+// scaled by the square root of its contribution to the weight variance.
+// More even weights give a higher efficiency of the later unweighting.
+// A final sampling with the adapted coefficients gives the largest cross
+// section found, as a complement to the later maximum search.
+
+double PhaseSpace::adaptSampling123(bool is2, bool is3) {
+
+  // Only adapt in dimensions with a choice between several shapes.
+  bool adaptTau = !hasTwoPointParticles && nTau > 1;
+  bool adaptY   = !hasOnePointParticle && !hasTwoPointParticles;
+  bool adaptZ   = is2;
+  if (!adaptTau && !adaptY && !adaptZ) return 0.;
+
+  // Optional printout.
+  if (showSearch) cout << "\n PYTHIA Adaptation of coefficients for "
+    << sigmaProcessPtr->name() << "\n";
+
+  // Iterate the adaptation. Shapes are stored in the selection meanwhile.
+  double varTau[8], varY[8], varZ[8];
+  double sigmaMaxAdapt = 0.;
+  storeShape = true;
+  for (int iIter = 0; iIter <= nAdaptIter; ++iIter) {
+    for (int i = 0; i < 8; ++i) {
+      varTau[i] = 0.;
+      varY[i]   = 0.;
+      varZ[i]   = 0.;
+    }
+    double sigmaSum = 0.;
+    double sigmaMaxNow = 0.;
+
+    // Select tau, y and z according to the current coefficients.
+    for (int iPoint = 0; iPoint < nAdaptPoints; ++iPoint) {
+      int iTau = 0;
+      if (!hasTwoPointParticles) {
+        double rTau = rndmPtr->flat();
+        while (rTau > tauCoefSum[iTau]) ++iTau;
+      }
+      selectTau( iTau, rndmPtr->flat(), is2);
+      if (!limitY()) continue;
+      int iY = 0;
+      if (!hasOnePointParticle && !hasTwoPointParticles) {
+        double rY = rndmPtr->flat();
+        while (rY > yCoefSum[iY]) ++iY;
+      }
+      selectY( iY, rndmPtr->flat());
+      if (is2) {
+        if (!limitZ()) continue;
+        int iZ = 0;
+        double rZ = rndmPtr->flat();
+        while (rZ > zCoefSum[iZ]) ++iZ;
+        selectZ( iZ, rndmPtr->flat());
+      }
+
+      // 2 -> 1: calculate cross section, weighted by phase-space volume.
+      double sigmaTmp = 0.;
+      if (!is2 && !is3) {
+        sigmaProcessPtr->set1Kin( x1H, x2H, sH);
+        sigmaTmp = sigmaProcessPtr->sigmaPDF(true);
+        sigmaTmp *= wtTau * wtY;
+
+      // 2 -> 2: calculate cross section, weighted by phase-space volume
+      // and Breit-Wigners for masses
+      } else if (is2) {
+        sigmaProcessPtr->set2Kin( x1H, x2H, sH, tH, m3, m4,
+          runBW3H, runBW4H);
+        sigmaTmp = sigmaProcessPtr->sigmaPDF(true);
+        sigmaTmp *= wtTau * wtY * wtZ * wtBW;
+
+      // 2 -> 3: also sample internal 3-body phase, weighted by
+      // 2 -> 1 phase-space volume and Breit-Wigners for masses
+      } else if (is3) {
+        if (!select3Body()) continue;
+        sigmaProcessPtr->set3Kin( x1H, x2H, sH, p3cm, p4cm, p5cm,
+          m3, m4, m5, runBW3H, runBW4H, runBW5H);
+        sigmaTmp = sigmaProcessPtr->sigmaPDF(true);
+        sigmaTmp *= wtTau * wtY * wt3Body * wtBW;
+      }
+
+      // Allow possibility for user to modify cross section.
+      if (canModifySigma) sigmaTmp
+        *= userHooksPtr->multiplySigmaBy( sigmaProcessPtr, this, false);
+      if (canBiasSelection) sigmaTmp
+        *= userHooksPtr->biasSelectionBy( sigmaProcessPtr, this, false);
+      if (canBias2Sel) sigmaTmp *= pow( pTH / bias2SelRef, bias2SelPow);
+      if (sigmaTmp <= 0.) continue;
+      sigmaSum += sigmaTmp;
+      if (sigmaTmp > sigmaMaxNow) sigmaMaxNow = sigmaTmp;
+
+      // Sum up contribution of each shape to the weight variance.
+      double sigma2 = pow2(sigmaTmp);
+      if (adaptTau) for (int i = 0; i < nTau; ++i)
+        varTau[i] += sigma2 * tauShape[i] * wtTau;
+      if (adaptY) for (int i = 0; i < nY; ++i)
+        varY[i]   += sigma2 * yShape[i] * wtY;
+      if (adaptZ) for (int i = 0; i < nZ; ++i)
+        varZ[i]   += sigma2 * zShape[i] * wtZ / max( TINY, mHat * pAbs);
+    }
+
+    // Optional printout of efficiency with current coefficients.
+    if (showSearch) cout << "\n Iteration " << setw(3) << iIter
+      << "  <sigma> =" << setw(11) << sigmaSum / nAdaptPoints
+      << "  sigma max =" << setw(11) << sigmaMaxNow << "  efficiency ="
+      << setw(11) << sigmaSum / max( TINY, nAdaptPoints * sigmaMaxNow)
+      << "\n";
+
+    // Done after final sampling, or if all cross sections vanish.
+    if (iIter == nAdaptIter) sigmaMaxAdapt = sigmaMaxNow;
+    if (iIter == nAdaptIter || sigmaSum <= 0.) break;
+
+    // Find new coefficients and their cumulative sum.
+    if (adaptTau) adaptCoef( nTau, varTau, tauCoef);
+    if (adaptY)   adaptCoef( nY, varY, yCoef);
+    if (adaptZ)   adaptCoef( nZ, varZ, zCoef);
+    sumCoef123();
+  }
+  storeShape = false;
+  if (showSearch) cout << "\n";
+  return sigmaMaxAdapt;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Scale coefficients by the square root of their variance contribution.
+
+void PhaseSpace::adaptCoef( int n, double var[8], double coef[8]) {
+
+  // Unnormalized new coefficients.
+  double coefTmp[8];
+  double coefSum = 0.;
+  for (int i = 0; i < n; ++i) {
+    coefTmp[i] = coef[i] * sqrt( max( 0., var[i]) );
+    coefSum += coefTmp[i];
+  }
+  if (coefSum < TINY) return;
+
+  // Normalize coefficients, with small piece shared democratically.
+  for (int i = 0; i < n; ++i) coef[i] = ADAPTEVENFRAC / n
+    + (1. - ADAPTEVENFRAC) * coefTmp[i] / coefSum;
+
+  // Optional printout.
+  if (showSearch) {
+    cout << " Adapted solution:     ";
+    for (int i = 0; i < n; ++i) cout << setw(12) << coef[i];
+    cout << "\n";
+  }
+}
+
+//--------------------------------------------------------------------------
+
 // Select a trial kinematics phase space point.
 // Note: by In is meant the integral over the quantity multiplying
 // coefficient cn. The sum of cn is normalized to unity.
@@ -1322,6 +1498,25 @@ void PhaseSpace::selectTau(int iTau, double tauVal, bool is2) {
       * tau / max( LEPTONTAUMIN, 1. - tau);
   wtTau = 1. / invWtTau;
 
+  // Optionally store the individual shapes, for adaptation of coefficients.
+  if (storeShape) {
+    for (int i = 0; i < 8; ++i) tauShape[i] = 0.;
+    tauShape[0] = 1. / intTau0;
+    tauShape[1] = (1. / intTau1) / tau;
+    if (idResA != 0) {
+      tauShape[2] = (1. / intTau2) / (tau + tauResA);
+      tauShape[3] = (1. / intTau3)
+        * tau / ( pow2(tau - tauResA) + pow2(widResA) );
+    }
+    if (idResB != 0) {
+      tauShape[4] = (1. / intTau4) / (tau + tauResB);
+      tauShape[5] = (1. / intTau5)
+        * tau / ( pow2(tau - tauResB) + pow2(widResB) );
+    }
+    if (hasTwoLeptonBeams) tauShape[nTau - 1] = (1. / intTau6)
+      * tau / max( LEPTONTAUMIN, 1. - tau);
+  }
+
   // Calculate sHat and absolute momentum of outgoing partons.
   sH = tau * s;
   mHat = sqrt(sH);
@@ -1403,6 +1598,20 @@ void PhaseSpace::selectY(int iY, double yVal) {
     +  (yCoef[4] / intY56) / max( LEPTONXMIN, 1. - exp(-y - yMax) );
   wtY = 1. / invWtY;
 
+  // Optionally store the individual shapes, for adaptation of coefficients.
+  if (storeShape) {
+    yShape[0] = (1. / intY0) / cosh(y);
+    yShape[1] = (1. / intY12) * (y + yMax);
+    yShape[2] = (1. / intY12) * (yMax - y);
+    if (!hasTwoLeptonBeams) {
+      yShape[3] = (1. / intY34) * exp(y);
+      yShape[4] = (1. / intY34) * exp(-y);
+    } else {
+      yShape[3] = (1. / intY56) / max( LEPTONXMIN, 1. - exp( y - yMax) );
+      yShape[4] = (1. / intY56) / max( LEPTONXMIN, 1. - exp(-y - yMax) );
+    }
+  }
+
   // Calculate x1 and x2.
   x1H = sqrt(tau) * exp(y);
   x2H = sqrt(tau) * exp(-y);
@@ -1518,6 +1727,15 @@ void PhaseSpace::selectZ(int iZ, double zVal) {
     + (zCoef[2] / area2) / zPos + (zCoef[3] / area3) / pow2(zNeg)
     + (zCoef[4] / area4) / pow2(zPos) );
 
+  // Optionally store the individual shapes, for adaptation of coefficients.
+  if (storeShape) {
+    zShape[0] = 1. / area0;
+    zShape[1] = (1. / area1) / zNeg;
+    zShape[2] = (1. / area2) / zPos;
+    zShape[3] = (1. / area3) / pow2(zNeg);
+    zShape[4] = (1. / area4) / pow2(zPos);
+  }
+
   // Calculate tHat and uHat. Also gives pTHat.
   double sH34 = -0.5 * (sH - s3 - s4);
   double tHuH = pow2(sH34) * (1. - z) * (1. + z) + s3 * s4 * pow2(z);
@@ -351,6 +351,7 @@ bool Pythia::setPDFPtr( PDFPtr pdfAPtrIn, PDFPtr pdfBPtrIn,
     = pdfVMDBPtr = nullptr;
 
   // Switch off external PDF's by zero as input.
+  hasUserPDFs = pdfAPtrIn || pdfBPtrIn;
   if ( !pdfAPtrIn && !pdfBPtrIn) return true;
 
   // The two PDF objects cannot be one and the same.
@@ -430,6 +431,7 @@ bool Pythia::setPDFAPtr( PDFPtr pdfAPtrIn ) {
     = pdfVMDBPtr = nullptr;
 
   // Switch off external PDF's by zero as input.
+  hasUserPDFs = bool(pdfAPtrIn);
   if (!pdfAPtrIn) return true;
 
   // Save pointers.
@@ -454,6 +456,7 @@ bool Pythia::setPDFBPtr( PDFPtr pdfBPtrIn ) {
     = pdfVMDBPtr = nullptr;
 
   // Switch off external PDF's by zero as input.
+  hasUserPDFs = bool(pdfBPtrIn);
   if (!pdfBPtrIn) return true;
 
   // Save pointers.
@@ -549,6 +552,12 @@ bool Pythia::init() {
     || doUNLOPSLoop || doUNLOPSSubt || doUNLOPSSubtNLO || doXSectionEst;
   doMerging = doMerging || settings.flag("Merging:doMerging");
 
+  // Trial shower workers can only be cloned if Pythia sets up all objects
+  // used in trial showers itself. The pointers cannot be tested directly,
+  // since they are also set by an earlier init.
+  bool canCloneTrialShowers = !userHooksPtr && !hasUserMerging
+    && !hasUserMergingHooks && !hasUserShowerModel && !hasUserPDFs;
+
   // If not using Vincia, Merging:Process must not be enclosed in {}.
   if (doMerging && showerModel != 2) {
     string mergingProc = settings.word("Merging:Process");
@@ -644,6 +653,10 @@ bool Pythia::init() {
     lhaUpPtr->setPtr( &infoPrivate);
     processLevel.setLHAPtr( lhaUpPtr);
 
+    // For files, choose how to skip events, and optionally the last event.
+    if (frameType == 4) lhaUpPtr->setReadMode( mode("Beams:LHEFindexMode"),
+      mode("Beams:nLastLHEF"));
+
     // If second time around, only with new file, then simplify.
     // Optionally skip ahead a number of events at beginning of file.
     if (skipInit) {
@@ -1075,6 +1088,26 @@ bool Pythia::init() {
   if (doMerging && mergingPtr && mergingHooksPtr) {
     mergingPtr->initPtrs( mergingHooksPtr, &trialPartonLevel);
     mergingPtr->init();
+
+    // Optionally set up workers to perform CKKW-L trial showers concurrently.
+    int nWorkers = mode("Merging:nTrialShowerWorkers");
+    trialShowerWorkers.clear();
+    mergingPtr->trialShowerWorkers.clear();
+    if (nWorkers > 0) {
+      if ( !canCloneTrialShowers || showerModel != 1 || frameType == 5
+        || doHeavyIons || !mergingHooksPtr->doCKKWLMerging()
+        || mergingHooksPtr->doWeakClustering() )
+        infoPrivate.errorMsg("Warning in Pythia::init: trial shower "
+          "workers not available for this setup; trial showers are "
+          "performed serially");
+      else if ( !initTrialShowerWorkers(nWorkers) ) {
+        infoPrivate.errorMsg("Warning in Pythia::init: trial shower "
+          "workers initialization failed; trial showers are performed "
+          "serially");
+        trialShowerWorkers.clear();
+        mergingPtr->trialShowerWorkers.clear();
+      }
+    }
   }
 
   // Send info/pointers to hadron level for initialization.
@@ -1518,6 +1551,32 @@ bool Pythia::initPDFs() {
 
 //--------------------------------------------------------------------------
 
+// Set up cloned generators that perform the trial showers of CKKW-L
+// merging concurrently. The clones start from copies of the settings and
+// particle data, with their own trial shower, merging hooks and random
+// numbers.
+
+bool Pythia::initTrialShowerWorkers(int nWorkers) {
+
+  for (int i = 0; i < nWorkers; ++i) {
+    shared_ptr<Pythia> worker
+      = make_shared<Pythia>( settings, particleData, false);
+    worker->readString("Merging:nTrialShowerWorkers = 0");
+    worker->readString("Print:quiet = on");
+    if ( !worker->init() || !worker->mergingHooksPtr ) return false;
+    trialShowerWorkers.push_back(worker);
+    mergingPtr->trialShowerWorkers.push_back( TrialShowerWorker(
+      &worker->trialPartonLevel, &worker->infoPrivate,
+      worker->mergingHooksPtr, &worker->particleData, &worker->rndm) );
+  }
+
+  // Done.
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
 // Main routine to generate the next event, using internal machinery.
 
 bool Pythia::next() {
@@ -1731,7 +1790,7 @@ bool Pythia::next() {
     }
 
     // Save spare copy of process record in case of problems.
-    Event processSave = process;
+    process.saveCheckpoint( processSave);
     int sizeMPI       = infoPrivate.sizeMPIarrays();
     infoPrivate.addCounter(12);
     for (int i = 14; i < 19; ++i) infoPrivate.setCounter(i);
@@ -1746,7 +1805,7 @@ bool Pythia::next() {
 
       // Restore original process record if problems.
       if (iTry > 0) {
-        process = processSave;
+        process.restoreCheckpoint( processSave);
         infoPrivate.resizeMPIarrays( sizeMPI);
       }
 
@@ -2418,6 +2477,9 @@ void Pythia::stat() {
     if (reset)   processLevel.resetStatistics();
   }
 
+  // Statistics on reading of Les Houches events, where relevant.
+  if (doProcessLevel && showPrL && doLHA && lhaUpPtr) lhaUpPtr->stat();
+
   // Statistics from other classes, currently multiparton interactions.
   if (showPaL) partonLevel.statistics(false);
   if (reset)   partonLevel.resetStatistics();
@@ -31,6 +31,19 @@ const double ResonanceWidths::MASSMIN        = 0.1;
 // The sum of product masses must not be too close to the resonance mass.
 const double ResonanceWidths::MASSMARGIN     = 0.1;
 
+// Number of initial intervals, maximal depth of bisection of an interval,
+// and maximal number of nodes, in tables of widths.
+const int    ResonanceWidths::NTABINIT       = 16;
+const int    ResonanceWidths::NTABDEPTH      = 16;
+const int    ResonanceWidths::NTABMAX        = 20000;
+
+// Tables extend this many widths above the nominal mass, unless mMax set.
+const double ResonanceWidths::TABNGAMMA      = 50.;
+
+// Tables are built to this fraction of the tolerance in the test points,
+// since the deviation in between, e.g. at a kink, can be larger.
+const double ResonanceWidths::TABSAFETY      = 0.25;
+
 //--------------------------------------------------------------------------
 
 // Initialize data members.
@@ -52,6 +65,12 @@ bool ResonanceWidths::init(Info* infoPtrIn) {
   minWidth     = settingsPtr->parm("ResonanceWidths:minWidth");
   minThreshold = settingsPtr->parm("ResonanceWidths:minThreshold");
 
+  // Optionally tabulate widths as a function of mass, built when needed.
+  doTabulate    = settingsPtr->flag("ResonanceWidths:tabulate");
+  checkTabulate = settingsPtr->flag("ResonanceWidths:checkTabulated");
+  tolTabulate   = settingsPtr->parm("ResonanceWidths:tabulateTolerance");
+  widthTables.clear();
+
   // Pointer to particle species.
   particlePtr  = particleDataPtr->particleDataEntryPtr(idRes);
   if (particlePtr->id() == 0) {
@@ -265,10 +284,60 @@ bool ResonanceWidths::init(Info* infoPtrIn) {
 //--------------------------------------------------------------------------
 
 // Calculate the total width and store phase-space-weighted coupling sums.
+// Use tabulated widths when so requested and possible.
 
 double ResonanceWidths::width(int idSgn, double mHatIn, int idInFlavIn,
   bool openOnly, bool setBR, int idOutFlav1, int idOutFlav2) {
 
+  // Direct calculation when no tables or for specific channels only.
+  if (!doTabulate || !allowCalcWidth || idOutFlav1 > 0 || idOutFlav2 > 0)
+    return widthCalc( idSgn, mHatIn, idInFlavIn, openOnly, setBR,
+      idOutFlav1, idOutFlav2);
+
+  // Interpolate in table, else direct calculation.
+  double widTab = 0.;
+  if (!checkTabulate) {
+    if (widthTabulated( idSgn, mHatIn, idInFlavIn, openOnly, setBR, widTab))
+      return widTab;
+    return widthCalc( idSgn, mHatIn, idInFlavIn, openOnly, setBR, 0, 0);
+  }
+
+  // Check mode: compare tabulated total and partial widths with direct
+  // calculation, and warn if they deviate by more than the tolerance.
+  vector<double> widChanTab, widChanCalc;
+  bool hasTab = widthTabulated( idSgn, mHatIn, idInFlavIn, openOnly, false,
+    widTab, &widChanTab);
+  double widSum = widthCalc( idSgn, mHatIn, idInFlavIn, openOnly, setBR,
+    0, 0, &widChanCalc);
+  if (hasTab) {
+    double widDiff = abs(widTab - widSum);
+    for (int i = 0; i < int(widChanCalc.size()); ++i)
+      widDiff = max( widDiff, abs(widChanTab[i] - widChanCalc[i]) );
+    if (widDiff > tolTabulate * widSum) {
+      ostringstream idCode;
+      idCode << idRes;
+      infoPtr->errorMsg("Warning in ResonanceWidths::width: tabulated"
+        " widths outside tolerance", "for id = " + idCode.str());
+    }
+  }
+  return widSum;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Calculate the total width by an explicit loop over all decay channels.
+// Optionally store the partial widths for later decay channel choice,
+// and optionally return them as well.
+
+double ResonanceWidths::widthCalc(int idSgn, double mHatIn, int idInFlavIn,
+  bool openOnly, bool setBR, int idOutFlav1, int idOutFlav2,
+  vector<double>* widChanPtr) {
+
+  // Reset any partial widths to be returned.
+  if (widChanPtr != nullptr)
+    widChanPtr->assign( particlePtr->sizeChannels(), 0.);
+
   // Calculate various prefactors for the current mass.
   mHat          = mHatIn;
   idInFlav      = idInFlavIn;
@@ -394,6 +463,7 @@ double ResonanceWidths::width(int idSgn, double mHatIn, int idInFlavIn,
 
     // Optionally store partial widths for later decay channel choice.
     if (setBR) particlePtr->channel(i).currentBR(widNow);
+    if (widChanPtr != nullptr) (*widChanPtr)[i] = widNow;
   }
 
   // Done.
@@ -403,6 +473,168 @@ double ResonanceWidths::width(int idSgn, double mHatIn, int idInFlavIn,
 
 //--------------------------------------------------------------------------
 
+// Find the total width, and optionally the partial widths, by linear
+// interpolation in a table of widths as a function of mass. Tables are
+// built the first time they are needed. Return false if the mass is
+// outside the table, or inside an interval that should be done directly.
+
+bool ResonanceWidths::widthTabulated(int idSgn, double mHatIn,
+  int idInFlavIn, bool openOnly, bool setBR, double& widSum,
+  vector<double>* widChanPtr) {
+
+  // Charge sign only matters for open widths. Find or build table.
+  int sgnNow = (!openOnly || idSgn == 0) ? 0 : ( (idSgn > 0) ? 1 : -1 );
+  int key    = 8 * idInFlavIn + 2 * (sgnNow + 1) + (openOnly ? 1 : 0);
+  map<int, WidthTable>::iterator tabItr = widthTables.find(key);
+  if (tabItr == widthTables.end()) {
+    tabItr = widthTables.insert( make_pair( key, WidthTable()) ).first;
+    buildWidthTable( tabItr->second, sgnNow, idInFlavIn, openOnly);
+  }
+  const WidthTable& table = tabItr->second;
+
+  // Find interval containing the mass, if any.
+  int nNode = table.mNode.size();
+  if (nNode < 2 || mHatIn < table.mNode[0]
+    || mHatIn > table.mNode[nNode - 1]) return false;
+  int iHigh = upper_bound( table.mNode.begin(), table.mNode.end(), mHatIn)
+            - table.mNode.begin();
+  iHigh     = min( max( iHigh, 1), nNode - 1);
+  int iLow  = iHigh - 1;
+  if (table.isExact[iLow]) return false;
+
+  // Linear interpolation of total width.
+  double wtHigh = (mHatIn - table.mNode[iLow])
+                / (table.mNode[iHigh] - table.mNode[iLow]);
+  double wtLow  = 1. - wtHigh;
+  int nStep     = table.nChan + 1;
+  const double* widLow  = &table.widNode[iLow * nStep];
+  const double* widHigh = &table.widNode[iHigh * nStep];
+  widSum        = wtLow * widLow[0] + wtHigh * widHigh[0];
+
+  // Optionally store or return interpolated partial widths.
+  if (widChanPtr != nullptr) widChanPtr->resize( table.nChan);
+  if (setBR || widChanPtr != nullptr) for (int i = 0; i < table.nChan; ++i) {
+    double widNowTab = wtLow * widLow[i + 1] + wtHigh * widHigh[i + 1];
+    if (setBR) particlePtr->channel(i).currentBR(widNowTab);
+    if (widChanPtr != nullptr) (*widChanPtr)[i] = widNowTab;
+  }
+
+  // Done.
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Build a table of total and partial widths over the allowed mass range
+// of the resonance, starting from an even grid that is then refined.
+
+void ResonanceWidths::buildWidthTable(WidthTable& table, int idSgn,
+  int idInFlavIn, bool openOnly) {
+
+  // Mass range of table. Without upper mass limit use a generous one.
+  double mLow  = max( MASSMIN, particlePtr->mMin());
+  double mHigh = (particlePtr->mMax() > particlePtr->mMin())
+               ? particlePtr->mMax()
+               : max( 2. * mRes, mRes + TABNGAMMA * GammaRes);
+  table.nChan  = particlePtr->sizeChannels();
+  if (mHigh <= mLow) return;
+
+  // Widths at the lower edge.
+  vector<double> widLow, widMid, widHigh;
+  widthNode( idSgn, mLow, idInFlavIn, openOnly, widLow);
+  table.mNode.push_back( mLow);
+  table.widNode.insert( table.widNode.end(), widLow.begin(), widLow.end());
+
+  // Step through initial intervals, each refined recursively.
+  double mStep = (mHigh - mLow) / NTABINIT;
+  for (int iStep = 1; iStep <= NTABINIT; ++iStep) {
+    double mNow = (iStep == NTABINIT) ? mHigh : mLow + iStep * mStep;
+    double mMid = 0.5 * (table.mNode.back() + mNow);
+    widthNode( idSgn, mMid, idInFlavIn, openOnly, widMid);
+    widthNode( idSgn, mNow, idInFlavIn, openOnly, widHigh);
+    refineWidthTable( table, idSgn, idInFlavIn, openOnly, table.mNode.back(),
+      widLow, mMid, widMid, mNow, widHigh, 0);
+    widLow.swap(widHigh);
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
+// Bisect an interval until linear interpolation agrees with the calculated
+// total and partial widths within the tolerance, relative to the total
+// width. This is tested in the midpoint, using the edges, and in the two
+// quarter points, using the edges and the midpoint, so as to be safe
+// also where the curvature changes sign. When accepted the quarter points,
+// midpoint and upper edge are appended. Intervals where this fails, or
+// where a channel opens or closes, are flagged to be calculated directly.
+
+void ResonanceWidths::refineWidthTable(WidthTable& table, int idSgn,
+  int idInFlavIn, bool openOnly, double mLow, const vector<double>& widLow,
+  double mMid, const vector<double>& widMid, double mHigh,
+  const vector<double>& widHigh, int depth) {
+
+  // Widths at the quarter points.
+  double mQ1 = 0.5 * (mLow + mMid);
+  double mQ3 = 0.5 * (mMid + mHigh);
+  vector<double> widQ1, widQ3;
+  widthNode( idSgn, mQ1, idInFlavIn, openOnly, widQ1);
+  widthNode( idSgn, mQ3, idInFlavIn, openOnly, widQ3);
+
+  // Largest deviation from linear interpolation.
+  double widDiff = 0.;
+  for (int i = 0; i <= table.nChan; ++i) widDiff = max( max( widDiff,
+    abs(0.5 * (widLow[i] + widHigh[i]) - widMid[i]) ), max(
+    abs(0.5 * (widLow[i] + widMid[i]) - widQ1[i]),
+    abs(0.5 * (widMid[i] + widHigh[i]) - widQ3[i]) ) );
+  bool isAccurate = (widDiff <= TABSAFETY * tolTabulate
+    * min( widLow[0], min( widMid[0], widHigh[0]) ) );
+
+  // Bisect further if not accurate and not too deep.
+  if (!isAccurate && depth < NTABDEPTH
+    && int(table.mNode.size()) < NTABMAX) {
+    refineWidthTable( table, idSgn, idInFlavIn, openOnly, mLow, widLow,
+      mQ1, widQ1, mMid, widMid, depth + 1);
+    refineWidthTable( table, idSgn, idInFlavIn, openOnly, mMid, widMid,
+      mQ3, widQ3, mHigh, widHigh, depth + 1);
+    return;
+  }
+
+  // Append the four quarters to the table. Check whether some channel
+  // opens or closes inside each of them.
+  const vector<double>* widQuart[5] = {&widLow, &widQ1, &widMid, &widQ3,
+    &widHigh};
+  double mQuart[5] = {mLow, mQ1, mMid, mQ3, mHigh};
+  for (int j = 1; j < 5; ++j) {
+    bool isExact = !isAccurate;
+    for (int i = 1; i <= table.nChan; ++i)
+      if ( ((*widQuart[j - 1])[i] == 0.) != ((*widQuart[j])[i] == 0.) )
+        isExact = true;
+    table.mNode.push_back( mQuart[j]);
+    table.widNode.insert( table.widNode.end(), widQuart[j]->begin(),
+      widQuart[j]->end());
+    table.isExact.push_back( isExact);
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
+// Calculate the total width, followed by the partial widths, for one
+// node of a table of widths.
+
+void ResonanceWidths::widthNode(int idSgn, double mHatIn, int idInFlavIn,
+  bool openOnly, vector<double>& widVal) {
+
+  double widSum = widthCalc( idSgn, mHatIn, idInFlavIn, openOnly, false,
+    0, 0, &widVal);
+  widVal.insert( widVal.begin(), widSum);
+
+}
+
+//--------------------------------------------------------------------------
+
 // Numerical integration of matrix-element in two-body decay,
 // where one particle is described by a Breit-Wigner mass distribution.
 // Normalization to unit integral if matrix element is unity
@@ -434,13 +434,11 @@ Exc(double yIn, double m0In, int iIn, int jIn, int kIn, RopeDipole* dip1In,
   RopeDipole* dip2In) : y(yIn), m0(m0In), i(iIn), j(jIn), k(kIn), pp1(NULL),
   pp2(NULL), dip1(dip1In), dip2(dip2In) { }
 
-// Set pointers to the two excitation particles.
+// Set pointers to the two excitation particles. The excitations are
+// already registered with their dipoles when the slice is set up.
 void setParticlePtrs(Particle* p1, Particle* p2) {
   pp1 = p1;
   pp2 = p2;
-  // Set a pointer to the excitation in the dipole.
-  dip1->addExcitation(y, pp1);
-  dip2->addExcitation(y, pp2);
 }
 
 // Give the excitation a kick in the x and y direction,
@@ -492,6 +490,141 @@ RopeDipole* dip2;
 
 //==========================================================================
 
+// ShoveSlice class.
+// Another helper class to Ropewalk, holding the string pieces in one
+// rapidity slice and the excitation pairs that may shove each other.
+// With a positive list radius only pairs closer than that in transverse
+// space are kept, found with a uniform grid, and the list is reused until
+// some string piece has moved too far. Pieces move between time steps,
+// but also when a shove recoils the ends of a dipole.
+
+//--------------------------------------------------------------------------
+
+struct ShoveSlice {
+
+// The constructor. Also find the string pieces that share a dipole end,
+// since a recoil of the end moves all of them.
+ShoveSlice(double yIn, vector<RopeDipole*>& dipsIn) : y(yIn), dips(dipsIn),
+  shared(dipsIn.size()), hasPairs(false) {
+  for (int j = 0, M = dips.size(); j < M; ++j)
+  for (int k = 0; k < M; ++k) {
+    int ej[2] = { dips[j]->d1Ptr()->getNe(), dips[j]->d2Ptr()->getNe() };
+    int ek[2] = { dips[k]->d1Ptr()->getNe(), dips[k]->d2Ptr()->getNe() };
+    if (j == k || ej[0] == ek[0] || ej[0] == ek[1] || ej[1] == ek[0]
+      || ej[1] == ek[1]) shared[j].push_back(k);
+  }
+}
+
+// Update the transverse positions and check if the pairs must be redone.
+bool needsPairs(double m0, double rList, double rMove) {
+  int M = dips.size();
+  bNow.resize(M);
+  for (int j = 0; j < M; ++j) bNow[j] = dips[j]->bInterpolateDip(y, m0);
+  if (!hasPairs) return true;
+  if (rList <= 0.) return false;
+  for (int j = 0; j < M; ++j)
+    if ( (bNow[j] - bList[j]).pT2() > pow2(rMove) ) return true;
+  return false;
+}
+
+// Update the positions after the pieces j and k have been shoved, and
+// check if the pairs must be redone.
+bool movedByShove(int j, int k, double m0, double rList, double rMove) {
+  if (rList <= 0.) return false;
+  bool moved = false;
+  for (int l = 0; l < 2; ++l) {
+    vector<int>& sh = shared[(l == 0) ? j : k];
+    for (int m = 0, L = sh.size(); m < L; ++m) {
+      bNow[sh[m]] = dips[sh[m]]->bInterpolateDip(y, m0);
+      if ( (bNow[sh[m]] - bList[sh[m]]).pT2() > pow2(rMove) ) moved = true;
+    }
+  }
+  return moved;
+}
+
+// Index of the first pair that comes after the pair (j, k).
+int nextPair(int j, int k) {
+  int i = 0;
+  for (int N = pairs.size(); i < N; ++i)
+    if (pairs[i].j > j || (pairs[i].j == j && pairs[i].k > k)) break;
+  return i;
+}
+
+// Set up the excitation pairs, in the same order as an all-pairs loop.
+void setPairs(int iSlice, double m0, vector<Particle>& ex, double rList) {
+  pairs.clear();
+  bList = bNow;
+  hasPairs = true;
+  int M = dips.size();
+
+  // Without a list radius all pairs are kept.
+  if (rList <= 0.) {
+    for (int j = 0; j < M; ++j)
+    for (int k = 0; k < M; ++k) {
+      // Don't allow a string to shove itself.
+      if (j != k && dips[j]->index() != dips[k]->index()) {
+        pairs.push_back( Exc(y, m0, iSlice, j, k, dips[j], dips[k]) );
+        pairs.back().setParticlePtrs( &ex[j], &ex[k] );
+      }
+    }
+    return;
+  }
+
+  // Sort the string pieces into a grid with cell size given by the radius.
+  map<pair<int,int>, vector<int> > grid;
+  vector<pair<int,int> > cells(M);
+  for (int j = 0; j < M; ++j) {
+    cells[j] = make_pair( cell(bNow[j].px() / rList),
+      cell(bNow[j].py() / rList) );
+    grid[cells[j]].push_back(j);
+  }
+
+  // Collect neighbours from the adjacent cells.
+  vector<int> near;
+  for (int j = 0; j < M; ++j) {
+    near.clear();
+    for (int ix = cells[j].first - 1; ix <= cells[j].first + 1; ++ix)
+    for (int iy = cells[j].second - 1; iy <= cells[j].second + 1; ++iy) {
+      map<pair<int,int>, vector<int> >::iterator gItr
+        = grid.find( make_pair(ix, iy) );
+      if (gItr == grid.end()) continue;
+      for (int l = 0, L = gItr->second.size(); l < L; ++l) {
+        int k = gItr->second[l];
+        if (j == k || dips[j]->index() == dips[k]->index()) continue;
+        if ( (bNow[j] - bNow[k]).pT2() < pow2(rList) ) near.push_back(k);
+      }
+    }
+    sort(near.begin(), near.end());
+    for (int l = 0, L = near.size(); l < L; ++l) {
+      int k = near[l];
+      pairs.push_back( Exc(y, m0, iSlice, j, k, dips[j], dips[k]) );
+      pairs.back().setParticlePtrs( &ex[j], &ex[k] );
+    }
+  }
+
+}
+
+// Grid cell index for a coordinate, in units of the cell size.
+static int cell(double x) {
+  if (abs(x) < 1e8) return int(floor(x));
+  return (x > 0.) ? 100000000 : -100000000;
+}
+
+// Slice rapidity and string pieces, and the pieces sharing an end.
+double y;
+vector<RopeDipole*> dips;
+vector<vector<int> > shared;
+
+// Transverse positions now and when the pairs were set up.
+vector<Vec4> bNow, bList;
+
+// The excitation pairs.
+bool hasPairs;
+vector<Exc> pairs;
+};
+
+//==========================================================================
+
 // Ropewalk class.
 // This class keeps track of all the strings making up ropes for shoving
 // as well as flavour enhancement.
@@ -522,6 +655,8 @@ bool Ropewalk::init() {
   tInit                = parm("Ropewalk:tInit");
   showerCut            = parm("TimeShower:pTmin");
   alwaysHighest        = flag("Ropewalk:alwaysHighest");
+  useNeighbourList     = flag("Ropewalk:useNeighbourList");
+  rSkin                = parm("Ropewalk:rSkin");
 
   // Creat the interface objects.
   if ( flag("Ropewalk:doShoving") ) {
@@ -625,11 +760,33 @@ double Ropewalk::getKappaHere(int e1, int e2, double yfrac) {
 
 bool Ropewalk::calculateOverlaps() {
 
+  // Only dipoles above the cutoff mass can overlap. Find them once.
+  vector<RopeDipole*> dips;
+  int nEnd = 0;
+  for (DMap::iterator itr = dipoles.begin(); itr != dipoles.end(); ++itr) {
+    RopeDipole* d = &(itr->second);
+    if (d->dipoleMomentum().m2Calc() < pow2(m0)) continue;
+    dips.push_back(d);
+    nEnd = max( nEnd, max(d->d1Ptr()->getNe(), d->d2Ptr()->getNe()) + 1);
+  }
+
+  // All dipole ends, counted once since neighbouring dipoles along a
+  // string share their ends.
+  vector<RopeDipoleEnd*> ends;
+  vector<bool> isEnd(nEnd, false);
+  for (int j = 0, N = dips.size(); j < N; ++j) {
+    RopeDipoleEnd* dEnds[2] = { dips[j]->d1Ptr(), dips[j]->d2Ptr() };
+    for (int k = 0; k < 2; ++k) if (!isEnd[dEnds[k]->getNe()]) {
+      isEnd[dEnds[k]->getNe()] = true;
+      ends.push_back(dEnds[k]);
+    }
+  }
+  vector<double> yEnd(nEnd, 0.), yUpp(dips.size(), 0.);
+  vector< pair<double,int> > yOrder(dips.size());
+
   // Go through all dipoles.
-  for (multimap< pair<int,int>, RopeDipole>::iterator itr = dipoles.begin();
-    itr != dipoles.end(); ++itr ) {
-    RopeDipole* d1 = &(itr->second);
-    if (d1->dipoleMomentum().m2Calc() < pow2(m0)) continue;
+  for (int i = 0, N = dips.size(); i < N; ++i) {
+    RopeDipole* d1 = dips[i];
 
     // RopeDipoles rapidities in dipole rest frame.
     RotBstMatrix dipoleRestFrame = d1->getDipoleRestFrame();
@@ -637,20 +794,28 @@ bool Ropewalk::calculateOverlaps() {
     double ya1 = d1->d2Ptr()->rap(m0, dipoleRestFrame);
     if (yc1 <= ya1) continue;
 
-    // Go through all possible overlapping dipoles.
-    for (multimap< pair<int,int>, RopeDipole>::iterator itr2 = dipoles.begin();
-      itr2 != dipoles.end(); ++itr2) {
-      RopeDipole* d2 = &(itr2->second);
+    // Rapidity range of every dipole in this frame, sorted in the lower
+    // edge, so that the sweep below stops at the first dipole that lies
+    // fully above the range of the current one.
+    for (int k = 0, nE = ends.size(); k < nE; ++k)
+      yEnd[ends[k]->getNe()] = ends[k]->rap(m0, dipoleRestFrame);
+    for (int j = 0; j < N; ++j) {
+      double y1 = yEnd[dips[j]->d1Ptr()->getNe()];
+      double y2 = yEnd[dips[j]->d2Ptr()->getNe()];
+      yOrder[j] = make_pair( min(y1, y2), j);
+      yUpp[j]   = max(y1, y2);
+    }
+    sort( yOrder.begin(), yOrder.end() );
 
-      // Skip self and overlaps with miniscule dipoles.
-      if (d1 == d2) continue;
-      if (d2->dipoleMomentum().m2Calc() < pow2(m0)) continue;
+    // Go through the dipoles that start below the upper edge.
+    for (int k = 0; k < N && yOrder[k].first <= yc1; ++k) {
+      int j = yOrder[k].second;
 
-      // Ignore if not overlapping in rapidity.
-      OverlappingRopeDipole od(d2, m0, dipoleRestFrame);
-      if (min(od.y1, od.y2) > yc1 || max(od.y1, od.y2) < ya1 || od.y1 == od.y2)
-        continue;
+      // Skip self and dipoles that end below the lower edge.
+      if (j == i || yUpp[j] < ya1 || yUpp[j] == yOrder[k].first) continue;
 
+      // Only now set up the transverse coordinates of the overlap.
+      OverlappingRopeDipole od(dips[j], m0, dipoleRestFrame);
       d1->addOverlappingDipole(od);
 
     }
@@ -658,6 +823,7 @@ bool Ropewalk::calculateOverlaps() {
   return true;
 
 }
+
 //--------------------------------------------------------------------------
 
 // Invoke the random walk of colour states.
@@ -742,8 +908,9 @@ void Ropewalk::shoveTheDipoles(Event& event) {
   vector<double> rapidities;
   for (double y = ymin; y < ymax; y += deltay) rapidities.push_back(y);
 
-  // For each value of ySample, we have a vector of excitation pairs.
-  map<double, vector<Exc> > exPairs;
+  // For each value of ySample, we have a slice of string pieces and
+  // the excitation pairs that may shove each other.
+  vector<ShoveSlice> slices;
   for (int i = 0, N = eParticles.size(); i < N; ++i) eParticles[i].clear();
   eParticles.clear();
   for (int i = 0, N = rapidities.size(); i < N; ++i) {
@@ -783,34 +950,43 @@ void Ropewalk::shoveTheDipoles(Event& event) {
       pp.vProd( tmp[j]->bInterpolateLab(ySample,m0) * FM2MM);
       eParticles[i].push_back(pp);
     }
-  // Construct all pairs of possible excitations in this slice.
-  exPairs[ySample] = vector<Exc>();
-  for (int j = 0, M = tmp.size(); j < M; ++j)
-    for (int k = 0; k < M; ++k) {
-       // Don't allow a string to shove itself.
-       if(j != k && tmp[j]->index() != tmp[k]->index() )
-         exPairs[ySample].push_back( Exc(ySample, m0, i, j, k, tmp[j],
-         tmp[k]) );
-    }
+  slices.push_back( ShoveSlice(ySample, tmp) );
   }
 
-  // Give the excitations pointers to the excitation particles.
-  for (map<double, vector<Exc> >::iterator slItr = exPairs.begin();
-    slItr != exPairs.end(); ++slItr) {
-    for (int i = 0, N = slItr->second.size(); i < N; ++i) {
-      Exc& ep = slItr->second[i];
-      ep.setParticlePtrs( &eParticles[ep.i][ep.j], &eParticles[ep.i][ep.k] );
+  // Give the dipoles pointers to their excitation particles, for all
+  // dipoles that have at least one other string to shove in the slice.
+  for (int i = 0, N = slices.size(); i < N; ++i) {
+    vector<RopeDipole*>& dips = slices[i].dips;
+    for (int j = 0, M = dips.size(); j < M; ++j)
+    for (int k = 0; k < M; ++k) {
+      if (j != k && dips[j]->index() != dips[k]->index()) {
+        dips[j]->addExcitation(slices[i].y, &eParticles[i][j]);
+        break;
+      }
     }
   }
 
+  // The largest interaction radius reached during the shoving. Neighbour
+  // lists include a skin on top of this, so they only need to be rebuilt
+  // when a string piece has moved by more than half the skin.
+  double rCutMax = rCutOff * min( max(tShove + tInit, 1. / showerCut / 5.068),
+    r0 * gExponent);
+  double rList = (useNeighbourList) ? rCutMax + rSkin : 0.;
+
   // Shoving loop.
   for (double t = tInit; t < tShove + tInit; t += deltat) {
     // For all slices.
-    for (map<double, vector<Exc> >::iterator slItr = exPairs.begin();
-      slItr != exPairs.end(); ++slItr)
+    for (int iSl = 0, nSl = slices.size(); iSl < nSl; ++iSl) {
+      ShoveSlice& slice = slices[iSl];
+      if (int(slice.dips.size()) < 2) continue;
+
+      // Set up or update the excitation pairs of the slice.
+      if (slice.needsPairs(m0, rList, 0.5 * rSkin))
+        slice.setPairs(iSl, m0, eParticles[iSl], rList);
+
       // For all excitation pairs.
-      for (int i = 0, N = slItr->second.size(); i < N; ++i) {
-        Exc& ep = slItr->second[i];
+      for (int i = 0; i < int(slice.pairs.size()); ++i) {
+        Exc& ep = slice.pairs[i];
         // The direction vector is a space-time four-vector.
         Vec4 direction = ep.direction();
         // The string radius is time dependent,
@@ -828,8 +1004,16 @@ void Ropewalk::shoveTheDipoles(Event& event) {
           double dpx = dist > 0.0 ? gain * direction.px() / dist: 0.0;
           double dpy = dist > 0.0 ? gain * direction.py() / dist: 0.0;
           ep.shove(dpx, dpy);
+          // The recoil may have moved the string pieces. If too far, redo
+          // the pairs and continue after the current one.
+          int j = ep.j, k = ep.k;
+          if (slice.movedByShove(j, k, m0, rList, 0.5 * rSkin)) {
+            slice.setPairs(iSl, m0, eParticles[iSl], rList);
+            i = slice.nextPair(j, k) - 1;
+          }
         }
       }
+    }
 
     // Propagate the dipoles.
     for (DMap::iterator dItr = dipoles.begin(); dItr != dipoles.end(); ++dItr)
@@ -32,6 +32,17 @@ void ShowerMEs::initPtrVincia(Info* infoPtrIn,
 
 //--------------------------------------------------------------------------
 
+// Get the matrix elements squared for several particle states.
+
+void ShowerMEs::me2VinciaBatch(const vector< vector<Particle> >& states,
+  int nIn, vector<double>& me2s) {
+  me2s.resize(states.size());
+  for (int i = 0; i < (int)states.size(); ++i)
+    me2s[i] = me2Vincia(states[i], nIn);
+}
+
+//--------------------------------------------------------------------------
+
 // Set helicities for a particle state.
 
 bool ShowerMEs::selectHelicitiesVincia(vector<Particle>& state, int nIn,
@@ -41,6 +41,7 @@ gzstreambuf* gzstreambuf::open( const char* name, int open_mode) {
     file = gzopen( name, fmode);
     if (file == Z_NULL)
         return (gzstreambuf*)0;
+    fileName = name;
     opened = 1;
     return this;
 }
@@ -51,6 +52,11 @@ gzstreambuf * gzstreambuf::close() {
     if ( is_open()) {
         sync();
         opened = 0;
+        end_inflate();
+        useInflate = recording = false;
+        if ( rawFile)
+            fclose( rawFile);
+        rawFile = 0;
         if ( gzclose( file) == Z_OK)
             return this;
     }
@@ -71,7 +77,8 @@ int gzstreambuf::underflow() { // used for input buffer only
         n_putback = 4;
     memcpy( buffer + (4 - n_putback), gptr() - n_putback, n_putback);
 
-    int num = gzread( file, buffer+4, bufferSize-4);
+    int num = useInflate ? inflate_buffer( buffer+4, bufferSize-4)
+        : gzread( file, buffer+4, bufferSize-4);
     if (num <= 0) // ERROR or EOF
         return EOF;
 
@@ -86,6 +93,273 @@ int gzstreambuf::underflow() { // used for input buffer only
 
 //--------------------------------------------------------------------------
 
+std::streampos gzstreambuf::seekoff( std::streamoff off,
+    std::ios_base::seekdir dir, std::ios_base::openmode) {
+    if ( ! (mode & std::ios::in) || ! opened)
+        return std::streampos(-1);
+    // current position is that of the decompression minus what is left
+    // in the buffer
+    long long posNow = (useInflate ? totOut : (long long)gztell( file))
+        - (egptr() - gptr());
+    if ( dir == std::ios_base::cur && off == 0)
+        return std::streampos(posNow);
+    long long posNew;
+    if ( dir == std::ios_base::beg)
+        posNew = off;
+    else if ( dir == std::ios_base::cur)
+        posNew = posNow + off;
+    else
+        return std::streampos(-1);
+    // with own decompression, a position still in the buffer is reached
+    // directly
+    long long posBuf = totOut - (egptr() - (buffer + 4));
+    if ( useInflate && posNew >= posBuf && posNew <= totOut) {
+        setg( eback(), buffer + 4 + (posNew - posBuf), egptr());
+        return std::streampos(posNew);
+    }
+    // empty buffer, to be refilled at new position
+    setg( buffer + 4, buffer + 4, buffer + 4);
+    if ( points.empty() && ! useInflate) {
+        if ( gzseek( file, posNew, SEEK_SET) < 0)
+            return std::streampos(-1);
+        return std::streampos(posNew);
+    }
+    // with access points, restart from the closest one before the new
+    // position, unless the current position is closer, and decompress up
+    // to the new position
+    recording = false;
+    const AccessPoint* point = 0;
+    for (int i = 0; i < int(points.size()) && points[i].out <= posNew; ++i)
+        point = &points[i];
+    if ( ! useInflate || ! hasStrm || posNew < totOut
+        || ( point && point->out > totOut))
+        if ( ! start_inflate( point))
+            return std::streampos(-1);
+    while ( totOut < posNew) {
+        long long nLeft = posNew - totOut;
+        int nSkip = (nLeft < bufferSize - 4) ? int(nLeft) : bufferSize - 4;
+        if ( inflate_buffer( buffer + 4, nSkip) <= 0)
+            return std::streampos(-1);
+    }
+    return std::streampos(posNew);
+}
+
+//--------------------------------------------------------------------------
+
+std::streampos gzstreambuf::seekpos( std::streampos pos,
+    std::ios_base::openmode which) {
+    return seekoff( std::streamoff(pos), std::ios_base::beg, which);
+}
+
+//--------------------------------------------------------------------------
+
+bool gzstreambuf::record_access_points( long long spanIn) {
+    // only for compressed input files that have not been read from yet
+    if ( ! (mode & std::ios::in) || ! opened || useInflate
+        || gptr() != egptr() || gztell( file) != 0 || gzdirect( file))
+        return false;
+    points.clear();
+    ring.assign( windowSize, 0);
+    span      = spanIn;
+    lastPoint = 0;
+    recording = true;
+    return start_inflate( 0);
+}
+
+//--------------------------------------------------------------------------
+
+bool gzstreambuf::start_inflate( const AccessPoint* point) {
+    // (re)start decompression, at the start of the file, where the gzip
+    // header is read, or at an access point, inside a raw deflate stream
+    end_inflate();
+    useInflate = true;
+    if ( ! rawFile)
+        rawFile = fopen( fileName.c_str(), "rb");
+    if ( ! rawFile)
+        return false;
+    isRaw = (point != 0);
+    strm.zalloc = Z_NULL;
+    strm.zfree  = Z_NULL;
+    strm.opaque = Z_NULL;
+    strm.next_in  = Z_NULL;
+    strm.avail_in = 0;
+    if ( inflateInit2( &strm, isRaw ? -15 : 47) != Z_OK)
+        return false;
+    hasStrm  = true;
+    nTrailer = 0;
+    totIn    = isRaw ? point->in : 0;
+    totOut   = isRaw ? point->out : 0;
+    long posIn = isRaw ? long(point->in - (point->bits ? 1 : 0)) : 0;
+    if ( fseek( rawFile, posIn, SEEK_SET) != 0)
+        return false;
+    if ( isRaw && point->bits) {
+        int c = getc( rawFile);
+        if ( c == EOF)
+            return false;
+        inflatePrime( &strm, point->bits, c >> (8 - point->bits));
+    }
+    if ( isRaw && ! point->window.empty())
+        inflateSetDictionary( &strm, &point->window[0],
+            point->window.size());
+    return true;
+}
+
+//--------------------------------------------------------------------------
+
+void gzstreambuf::end_inflate() {
+    if ( hasStrm)
+        inflateEnd( &strm);
+    hasStrm = false;
+}
+
+//--------------------------------------------------------------------------
+
+int gzstreambuf::inflate_buffer( char* out, int len) {
+    // decompress up to len bytes, with the stream either at the start of
+    // a gzip member or inside a raw deflate stream, and also continue
+    // into following members, as gzread does
+    if ( ! hasStrm)
+        return 0;
+    strm.next_out  = reinterpret_cast<Bytef*>( out);
+    strm.avail_out = len;
+    while ( hasStrm && strm.avail_out > 0) {
+        if ( strm.avail_in == 0) {
+            size_t n = fread( inBuf, 1, inSize, rawFile);
+            if ( n == 0)
+                break;
+            strm.next_in  = inBuf;
+            strm.avail_in = n;
+        }
+        // skip the gzip trailer after a raw deflate stream, and then
+        // continue with the header of the next member, if any
+        if ( nTrailer > 0) {
+            int nSkip = (int(strm.avail_in) < nTrailer)
+                ? int(strm.avail_in) : nTrailer;
+            strm.next_in  += nSkip;
+            strm.avail_in -= nSkip;
+            totIn         += nSkip;
+            nTrailer      -= nSkip;
+            if ( nTrailer == 0 && inflateReset2( &strm, 47) == Z_OK)
+                isRaw = false;
+            continue;
+        }
+        unsigned int availIn = strm.avail_in, availOut = strm.avail_out;
+        int ret = inflate( &strm, recording ? Z_BLOCK : Z_NO_FLUSH);
+        totIn += availIn - strm.avail_in;
+        int nOut = availOut - strm.avail_out;
+        if ( recording) {
+            const unsigned char* outNow = strm.next_out - nOut;
+            for ( int i = (nOut > windowSize) ? nOut - windowSize : 0;
+                  i < nOut; ++i)
+                ring[(totOut + i) % windowSize] = outNow[i];
+        }
+        totOut += nOut;
+        if ( ret == Z_STREAM_END) {
+            if ( isRaw)
+                nTrailer = 8;
+            else
+                inflateReset( &strm);
+            continue;
+        }
+        // corrupt data, or e.g. padding after the last member, ends input
+        if ( ret != Z_OK && ret != Z_BUF_ERROR) {
+            end_inflate();
+            break;
+        }
+        // possible access point at the end of a block, except the last one
+        if ( recording && (strm.data_type & 128) && ! (strm.data_type & 64)
+            && totOut - lastPoint >= span)
+            add_point();
+    }
+    return len - strm.avail_out;
+}
+
+//--------------------------------------------------------------------------
+
+void gzstreambuf::add_point() {
+    AccessPoint point;
+    point.out  = totOut;
+    point.in   = totIn;
+    point.bits = strm.data_type & 7;
+    int nWindow = (totOut < windowSize) ? int(totOut) : windowSize;
+    point.window.resize( nWindow);
+    for ( int i = 0; i < nWindow; ++i)
+        point.window[i] = ring[(totOut - nWindow + i) % windowSize];
+    points.push_back( point);
+    lastPoint = totOut;
+}
+
+//--------------------------------------------------------------------------
+
+long long gzstreambuf::file_size() {
+    FILE* f = fopen( fileName.c_str(), "rb");
+    if ( ! f)
+        return -1;
+    long long size = -1;
+    if ( fseek( f, 0, SEEK_END) == 0)
+        size = ftell( f);
+    fclose( f);
+    return size;
+}
+
+//--------------------------------------------------------------------------
+
+bool gzstreambuf::write_access_points( const char* name) {
+    // a text line with the size of the compressed file, to check that the
+    // points belong to it, followed by the points in binary form
+    if ( points.empty())
+        return false;
+    std::ofstream os( name, std::ios::binary);
+    os << "GZACCESS " << file_size() << " " << points.size() << "\n";
+    for ( int i = 0; i < int(points.size()); ++i) {
+        const AccessPoint& point = points[i];
+        int nWindow = point.window.size();
+        os.write( reinterpret_cast<const char*>( &point.out),
+            sizeof(long long));
+        os.write( reinterpret_cast<const char*>( &point.in),
+            sizeof(long long));
+        os.write( reinterpret_cast<const char*>( &point.bits), sizeof(int));
+        os.write( reinterpret_cast<const char*>( &nWindow), sizeof(int));
+        os.write( reinterpret_cast<const char*>( &point.window[0]), nWindow);
+    }
+    os.close();
+    return bool(os);
+}
+
+//--------------------------------------------------------------------------
+
+bool gzstreambuf::read_access_points( const char* name) {
+    std::ifstream is( name, std::ios::binary);
+    std::string tag;
+    long long size = -1;
+    int nPoints = 0;
+    if ( ! (is >> tag >> size >> nPoints) || tag != "GZACCESS"
+        || size != file_size() || nPoints <= 0)
+        return false;
+    is.get();
+    std::vector<AccessPoint> pointsIn( nPoints);
+    for ( int i = 0; i < nPoints; ++i) {
+        AccessPoint& point = pointsIn[i];
+        int nWindow = 0;
+        is.read( reinterpret_cast<char*>( &point.out), sizeof(long long));
+        is.read( reinterpret_cast<char*>( &point.in), sizeof(long long));
+        is.read( reinterpret_cast<char*>( &point.bits), sizeof(int));
+        is.read( reinterpret_cast<char*>( &nWindow), sizeof(int));
+        if ( ! is || nWindow <= 0 || nWindow > windowSize || point.bits < 0
+            || point.bits > 7 || point.in > size
+            || (i > 0 && point.out <= pointsIn[i - 1].out))
+            return false;
+        point.window.resize( nWindow);
+        is.read( reinterpret_cast<char*>( &point.window[0]), nWindow);
+        if ( ! is)
+            return false;
+    }
+    points.swap( pointsIn);
+    return true;
+}
+
+//--------------------------------------------------------------------------
+
 int gzstreambuf::flush_buffer() {
     // Separate the writing of the buffer from overflow() and
     // sync() operation.
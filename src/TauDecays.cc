@@ -232,13 +232,14 @@ bool TauDecays::decay(int idxOut1, Event& event) {
   vector<HelicityParticle> children = createChildren(*tau);
   if (children.size() == 0) return false;
 
-  // Decay the first tau.
+  // Decay the first tau. The maximum weight only depends on the tau
+  // density matrix, so is the same for all tries.
   bool accepted = false;
   int  tries    = 0;
+  double decayWeightMax = decayME->decayWeightMax(children);
   while (!accepted) {
     isotropicDecay(children);
     double decayWeight    = decayME->decayWeight(children);
-    double decayWeightMax = decayME->decayWeightMax(children);
     accepted = (rndmPtr->flat() < decayWeight / decayWeightMax);
     if (decayWeight > decayWeightMax)
       infoPtr->errorMsg("Warning in TauDecays::decay: maximum "
@@ -270,10 +271,10 @@ bool TauDecays::decay(int idxOut1, Event& event) {
     if (children.size() == 0) return false;
     accepted = false;
     tries    = 0;
+    decayWeightMax = decayME->decayWeightMax(children);
     while (!accepted) {
       isotropicDecay(children);
       double decayWeight    = decayME->decayWeight(children);
-      double decayWeightMax = decayME->decayWeightMax(children);
       accepted = (rndmPtr->flat() < decayWeight / decayWeightMax);
       if (decayWeight > decayWeightMax)
         infoPtr->errorMsg("Warning in TauDecays::decay: maximum "
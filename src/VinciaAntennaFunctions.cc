@@ -257,7 +257,8 @@ bool AntennaFunction::init() {
 // Method to initialise internal helicity variables. Return value =
 // number of helicity configurations to average over.
 
-int AntennaFunction::initHel(vector<int>* helBef, vector<int>* helNew) {
+int AntennaFunction::initHel(const vector<int>* helBef,
+  const vector<int>* helNew) {
 
   // Initialise as unpolarised.
   hA = 9; hB = 9; hi = 9; hj = 9; hk = 9;
@@ -602,8 +603,9 @@ string AntennaFunction::id2str(int id) const {
 
 // The antenna function [GeV^-2].
 
-double AntQQemitFF::antFun(vector<double> invariants, vector<double> masses,
-  vector<int> helBef, vector<int> helNew) {
+double AntQQemitFF::antFun(const vector<double>& invariants,
+  const vector<double>& masses, const vector<int>& helBef,
+  const vector<int>& helNew) {
 
   // Make sure we have enough invariants.
   if (invariants.size() <= 2) return 0.;
@@ -722,8 +724,9 @@ double AntQQemitFF::AltarelliParisi(vector<double> invariants,
 
 // The antenna function [GeV^-2].
 
-double AntQGemitFF::antFun(vector<double> invariants, vector<double> masses,
-  vector<int> helBef, vector<int> helNew) {
+double AntQGemitFF::antFun(const vector<double>& invariants,
+  const vector<double>& masses, const vector<int>& helBef,
+  const vector<int>& helNew) {
 
   // Make sure we have enough invariants.
   if (invariants.size() <= 2) return 0.;
@@ -841,14 +844,19 @@ double AntQGemitFF::AltarelliParisi(vector<double> invariants,
 
 // The antenna function [GeV^-2] (derived from AntQGemit by swapping).
 
-double AntGQemitFF::antFun(vector<double> invariants,
-  vector<double> mNew, vector<int> helBef, vector<int> helNew) {
+double AntGQemitFF::antFun(const vector<double>& invariants,
+  const vector<double>& mNew, const vector<int>& helBef,
+  const vector<int>& helNew) {
 
-  swap(invariants[1], invariants[2]);
-  swap(mNew[0], mNew[2]);
-  swap(helBef[0], helBef[1]);
-  swap(helNew[0], helNew[2]);
-  return AntQGemitFF::antFun(invariants, mNew, helBef, helNew);
+  invSwap  = invariants;
+  mSwap    = mNew;
+  hBefSwap = helBef;
+  hNewSwap = helNew;
+  swap(invSwap[1], invSwap[2]);
+  swap(mSwap[0], mSwap[2]);
+  swap(hBefSwap[0], hBefSwap[1]);
+  swap(hNewSwap[0], hNewSwap[2]);
+  return AntQGemitFF::antFun(invSwap, mSwap, hBefSwap, hNewSwap);
 
 }
 
@@ -883,8 +891,9 @@ double AntGQemitFF::AltarelliParisi(vector<double> invariants,
 
 // The antenna function [GeV^-2].
 
-double AntGGemitFF::antFun(vector<double> invariants, vector<double>,
-  vector<int> helBef, vector<int> helNew) {
+double AntGGemitFF::antFun(const vector<double>& invariants,
+  const vector<double>&, const vector<int>& helBef,
+  const vector<int>& helNew) {
 
   // Make sure we have enough invariants.
   if (invariants.size() <= 2) return 0.;
@@ -984,8 +993,9 @@ double AntGGemitFF::AltarelliParisi(vector<double> invariants,
 
 // The antenna function [GeV^-2].
 
-double AntGXsplitFF::antFun(vector<double> invariants, vector<double> masses,
-  vector<int> helBef, vector<int> helNew) {
+double AntGXsplitFF::antFun(const vector<double>& invariants,
+  const vector<double>& masses, const vector<int>& helBef,
+  const vector<int>& helNew) {
 
   // Make sure we have enough invariants.
   if (invariants.size() <= 2) return 0.;
@@ -1086,14 +1096,14 @@ double AntGXsplitFF::AltarelliParisi(vector<double> invariants,
 
 // The antenna function [GeV^-2].
 
-double AntQGemitFFsec::antFun(vector<double> invariants,
-  vector<double> mNew, vector<int> helBef, vector<int> helNew) {
+double AntQGemitFFsec::antFun(const vector<double>& invariants,
+  const vector<double>& mNew, const vector<int>& helBef,
+  const vector<int>& helNew) {
 
   // Check if helicity vectors empty.
   double ant = AntQGemitFF::antFun(invariants, mNew, helBef, helNew);
-  if (helBef.size() < 2) {helBef.push_back(9); helBef.push_back(9);}
-  if (helNew.size() < 3) {
-    helNew.push_back(9); helNew.push_back(9); helNew.push_back(9);}
+  const vector<int>& hBef = padHel(helBef, hBefPad, 2);
+  const vector<int>& hNew = padHel(helNew, hNewPad, 3);
 
   // Save invariants.
   double sIK = invariants[0];
@@ -1104,17 +1114,17 @@ double AntQGemitFFsec::antFun(vector<double> invariants,
   double yjk = sjk/sIK;
 
   // Check if j has same helicity as parent gluon.
-  int hG = helBef[1];
-  int hjNow = helNew[1];
+  int hG = hBef[1];
+  int hjNow = hNew[1];
   if ( hG == hjNow || hjNow == 9) {
     // Define j<->k symmetrisation term with sector damp parameter;
     sik += sectorDampSav * sjk;
-    vector<double> invariantsSym = {sIK, sik, sjk};
+    invSym = {sIK, sik, sjk};
     // Swap helicities.
-    vector<int> helSym = helNew;
-    helSym[1] = helNew[2];
-    helSym[2] = helNew[1];
-    ant += AntQGemitFF::antFun(invariantsSym, mNew, helBef, helSym);
+    hSym = hNew;
+    hSym[1] = hNew[2];
+    hSym[2] = hNew[1];
+    ant += AntQGemitFF::antFun(invSym, mNew, hBef, hSym);
   }
 
   // Subleading colour correction has to be applied after symmetrisation.
@@ -1134,14 +1144,19 @@ double AntQGemitFFsec::antFun(vector<double> invariants,
 
 // The antenna function [GeV^-2] (derived from AntQGemitFFsec by swapping).
 
-double AntGQemitFFsec::antFun(vector<double> invariants,
-  vector<double> mNew, vector<int> helBef, vector<int> helNew) {
+double AntGQemitFFsec::antFun(const vector<double>& invariants,
+  const vector<double>& mNew, const vector<int>& helBef,
+  const vector<int>& helNew) {
 
-  swap(invariants[1], invariants[2]);
-  swap(mNew[0], mNew[2]);
-  swap(helBef[0], helBef[1]);
-  swap(helNew[0], helNew[2]);
-  return AntQGemitFFsec::antFun(invariants, mNew, helBef, helNew);
+  invSwap  = invariants;
+  mSwap    = mNew;
+  hBefSwap = helBef;
+  hNewSwap = helNew;
+  swap(invSwap[1], invSwap[2]);
+  swap(mSwap[0], mSwap[2]);
+  swap(hBefSwap[0], hBefSwap[1]);
+  swap(hNewSwap[0], hNewSwap[2]);
+  return AntQGemitFFsec::antFun(invSwap, mSwap, hBefSwap, hNewSwap);
 
 }
 
@@ -1177,38 +1192,38 @@ double AntGQemitFFsec::AltarelliParisi(vector<double> invariants,
 
 // The antenna function [GeV^-2].
 
-double AntGGemitFFsec::antFun(vector<double> invariants, vector<double> mNew,
-  vector<int> helBef, vector<int> helNew) {
+double AntGGemitFFsec::antFun(const vector<double>& invariants,
+  const vector<double>& mNew, const vector<int>& helBef,
+  const vector<int>& helNew) {
 
   // Check if helicity vectors empty
   double ant = AntGGemitFF::antFun(invariants, mNew, helBef, helNew);
-  if (helBef.size() < 2) {helBef.push_back(9); helBef.push_back(9);}
-  if (helNew.size() < 3) {
-    helNew.push_back(9); helNew.push_back(9); helNew.push_back(9);}
+  const vector<int>& hBef = padHel(helBef, hBefPad, 2);
+  const vector<int>& hNew = padHel(helNew, hNewPad, 3);
 
   // Check if j has same helicity as parent gluon 0.
-  int hjNow = helNew[1];
-  if (helBef[0] == hjNow) {
+  int hjNow = hNew[1];
+  if (hBef[0] == hjNow) {
     // Define i<->j symmetrisation term.
-    vector<double> invariantsSym = invariants;
+    invSym = invariants;
     double s02 = invariants[0] - invariants[1] - invariants[2];
-    vector<int> helSym = helNew;
-    helSym[0] = helNew[1];
-    helSym[1] = helNew[0];
-    invariantsSym[2] = s02 + sectorDampSav * invariants[1];
-    ant += AntGGemitFF::antFun(invariantsSym, mNew, helBef, helSym);
+    hSym = hNew;
+    hSym[0] = hNew[1];
+    hSym[1] = hNew[0];
+    invSym[2] = s02 + sectorDampSav * invariants[1];
+    ant += AntGGemitFF::antFun(invSym, mNew, hBef, hSym);
   }
 
   // Check if j has same helicity as parent gluon 1.
-  if (helBef[1] == hjNow) {
+  if (hBef[1] == hjNow) {
     // Define j<->k symmetrisation term.
-    vector<double> invariantsSym = invariants;
+    invSym = invariants;
     double s02 = invariants[0] - invariants[1] - invariants[2];
-    vector<int> helSym = helNew;
-    helSym[1] = helNew[2];
-    helSym[2] = helNew[1];
-    invariantsSym[1] = s02 + sectorDampSav * invariants[2];
-    ant += AntGGemitFF::antFun(invariantsSym, mNew, helBef, helSym);
+    hSym = hNew;
+    hSym[1] = hNew[2];
+    hSym[2] = hNew[1];
+    invSym[1] = s02 + sectorDampSav * invariants[2];
+    ant += AntGGemitFF::antFun(invSym, mNew, hBef, hSym);
   }
   return ant;
 
@@ -1223,8 +1238,9 @@ double AntGGemitFFsec::antFun(vector<double> invariants, vector<double> mNew,
 
 // The antenna function [GeV^-2] (just 2*global).
 
-double AntGXsplitFFsec::antFun(vector<double> invariants, vector<double> mNew,
-  vector<int> helBef, vector<int> helNew) {
+double AntGXsplitFFsec::antFun(const vector<double>& invariants,
+  const vector<double>& mNew, const vector<int>& helBef,
+  const vector<int>& helNew) {
   return 2*AntGXsplitFF::antFun(invariants,mNew,helBef,helNew);}
 
 //==========================================================================
@@ -1518,8 +1534,9 @@ bool AntennaFunctionIX::check() {
 
 // The antenna function [GeV^-2].
 
-double AntQQemitII::antFun(vector<double> invariants, vector<double> masses,
-  vector<int> helBef, vector<int> helNew) {
+double AntQQemitII::antFun(const vector<double>& invariants,
+  const vector<double>& masses, const vector<int>& helBef,
+  const vector<int>& helNew) {
 
   // Invariants.
   double sAB = invariants[0];
@@ -1653,8 +1670,9 @@ double AntQQemitII::AltarelliParisi(vector<double> invariants, vector<double>,
 
 // The antenna function [GeV^-2].
 
-double AntGQemitII::antFun(vector<double> invariants, vector<double> masses,
-  vector<int> helBef, vector<int> helNew) {
+double AntGQemitII::antFun(const vector<double>& invariants,
+  const vector<double>& masses, const vector<int>& helBef,
+  const vector<int>& helNew) {
 
   // Invariants and helicities.
   double sAB = invariants[0];
@@ -1789,8 +1807,9 @@ double AntGQemitII::AltarelliParisi(vector<double> invariants,
 
 // The antenna function [GeV^-2].
 
-double AntGGemitII::antFun(vector<double> invariants, vector<double>,
-  vector<int> helBef, vector<int> helNew) {
+double AntGGemitII::antFun(const vector<double>& invariants,
+  const vector<double>&, const vector<int>& helBef,
+  const vector<int>& helNew) {
 
   // Invariants and helicities.
   double sAB = invariants[0];
@@ -1912,8 +1931,9 @@ double AntGGemitII::AltarelliParisi(vector<double> invariants, vector<double>,
 
 // The antenna function [GeV^-2].
 
-double AntQXsplitII::antFun(vector<double> invariants, vector<double> masses,
-  vector<int> helBef, vector<int> helNew) {
+double AntQXsplitII::antFun(const vector<double>& invariants,
+  const vector<double>& masses, const vector<int>& helBef,
+  const vector<int>& helNew) {
 
   // Invariants and helicities.
   double sAB = invariants[0];
@@ -2023,8 +2043,9 @@ double AntQXsplitII::AltarelliParisi(vector<double> invariants, vector<double>,
 
 // The antenna function [GeV^-2].
 
-double AntGXconvII::antFun(vector<double> invariants, vector<double> masses,
-  vector<int> helBef, vector<int> helNew) {
+double AntGXconvII::antFun(const vector<double>& invariants,
+  const vector<double>& masses, const vector<int>& helBef,
+  const vector<int>& helNew) {
 
   // Invariants and helicities.
   double sAB = invariants[0];
@@ -2592,8 +2613,9 @@ double AntennaFunctionIF::antFunCollLimit(vector<double> invariants,
 
 // The antenna function [GeV^-2].
 
-double AntQQemitIF::antFun(vector<double> invariants, vector<double> masses,
-  vector<int> helBef, vector<int> helNew) {
+double AntQQemitIF::antFun(const vector<double>& invariants,
+  const vector<double>& masses, const vector<int>& helBef,
+  const vector<int>& helNew) {
 
   // Invariants and helicities.
   double sAK = invariants[0];
@@ -2730,8 +2752,9 @@ double AntQQemitIF::AltarelliParisi(vector<double> invariants, vector<double>,
 
 // The antenna function [GeV^-2].
 
-double AntQGemitIF::antFun(vector<double> invariants, vector<double> masses,
-  vector<int> helBef, vector<int> helNew) {
+double AntQGemitIF::antFun(const vector<double>& invariants,
+  const vector<double>& masses, const vector<int>& helBef,
+  const vector<int>& helNew) {
 
   // Invariants and helicities.
   double sAK = invariants[0];
@@ -2859,8 +2882,9 @@ double AntQGemitIF::AltarelliParisi(vector<double> invariants, vector<double>,
 
 // The antenna function [GeV^-2].
 
-double AntGQemitIF::antFun(vector<double> invariants, vector<double> masses,
-  vector<int> helBef, vector<int> helNew) {
+double AntGQemitIF::antFun(const vector<double>& invariants,
+  const vector<double>& masses, const vector<int>& helBef,
+  const vector<int>& helNew) {
 
   // Invariants and helicities.
   double sAK = invariants[0];
@@ -2995,8 +3019,9 @@ double AntGQemitIF::AltarelliParisi(vector<double> invariants, vector<double>,
 
 // The antenna function [GeV^-2].
 
-double AntGGemitIF::antFun(vector<double> invariants, vector<double>,
-  vector<int> helBef, vector<int> helNew) {
+double AntGGemitIF::antFun(const vector<double>& invariants,
+  const vector<double>&, const vector<int>& helBef,
+  const vector<int>& helNew) {
 
   // Invariants and helicities.
   double sAK = invariants[0];
@@ -3108,8 +3133,9 @@ double AntGGemitIF::AltarelliParisi(vector<double> invariants, vector<double>,
 
 // The antenna function [GeV^-2].
 
-double AntQXsplitIF::antFun(vector<double> invariants, vector<double> masses,
-  vector<int> helBef, vector<int> helNew) {
+double AntQXsplitIF::antFun(const vector<double>& invariants,
+  const vector<double>& masses, const vector<int>& helBef,
+  const vector<int>& helNew) {
 
   // Invariants and helicities.
   double sAK = invariants[0];
@@ -3218,8 +3244,9 @@ double AntQXsplitIF::AltarelliParisi(vector<double> invariants, vector<double>,
 
 // The antenna function [GeV^-2].
 
-double AntGXconvIF::antFun(vector<double> invariants, vector<double> masses,
-  vector<int> helBef, vector<int> helNew) {
+double AntGXconvIF::antFun(const vector<double>& invariants,
+  const vector<double>& masses, const vector<int>& helBef,
+  const vector<int>& helNew) {
 
   // Invariants and helicities.
   double sAK = invariants[0];
@@ -3332,8 +3359,9 @@ double AntGXconvIF::AltarelliParisi(vector<double> invariants, vector<double>,
 
 // The antenna function [GeV^-2].
 
-double AntXGsplitIF::antFun(vector<double> invariants, vector<double> masses,
-  vector<int> helBef, vector<int> helNew) {
+double AntXGsplitIF::antFun(const vector<double>& invariants,
+  const vector<double>& masses, const vector<int>& helBef,
+  const vector<int>& helNew) {
 
   // Invariants and helicities
   double sAK = invariants[0];
@@ -3442,14 +3470,14 @@ double AntXGsplitIF::AltarelliParisi(vector<double> invariants, vector<double>,
 
 // The antenna function [GeV^-2].
 
-double AntQGemitIFsec::antFun(vector<double> invariants,
-  vector<double> mNew, vector<int> helBef, vector<int> helNew) {
+double AntQGemitIFsec::antFun(const vector<double>& invariants,
+  const vector<double>& mNew, const vector<int>& helBef,
+  const vector<int>& helNew) {
 
   // Check if helicity vectors empty.
   double ant = AntQGemitIF::antFun(invariants, mNew, helBef, helNew);
-  if (helBef.size() < 2) {helBef.push_back(9); helBef.push_back(9);}
-  if (helNew.size() < 3) {
-    helNew.push_back(9); helNew.push_back(9); helNew.push_back(9);}
+  const vector<int>& hBef = padHel(helBef, hBefPad, 2);
+  const vector<int>& hNew = padHel(helNew, hNewPad, 3);
 
   // Save invariants.
   double sAK = invariants[0];
@@ -3461,17 +3489,17 @@ double AntQGemitIFsec::antFun(vector<double> invariants,
   double yak = sak/(sAK + sjk);
 
   // Check if j has same helicity as parent final-state gluon.
-  int hG = helBef[1];
-  int hjNow = helNew[1];
+  int hG = hBef[1];
+  int hjNow = hNew[1];
   if (hG == hjNow) {
     // Define j<->k symmetrisation term with sector damp parameter.
     sak += sectorDampSav * sjk;
-    vector<double> invariantsSym = {sAK, sak, sjk};
+    invSym = {sAK, sak, sjk};
     // Save swapped helicities.
-    vector<int> helSym = helNew;
-    helSym[1] = helNew[2];
-    helSym[2] = helNew[1];
-    ant += AntQGemitIF::antFun(invariantsSym, mNew, helBef, helSym);
+    hSym = hNew;
+    hSym[1] = hNew[2];
+    hSym[2] = hNew[1];
+    ant += AntQGemitIF::antFun(invSym, mNew, hBef, hSym);
 
     // Ensure positivity over all of phase space.
     ant += 1./sAK * (yak + yjk);
@@ -3494,14 +3522,14 @@ double AntQGemitIFsec::antFun(vector<double> invariants,
 
 // The antenna function [GeV^-2].
 
-double AntGGemitIFsec::antFun(vector<double> invariants,
-  vector<double> mNew, vector<int> helBef, vector<int> helNew) {
+double AntGGemitIFsec::antFun(const vector<double>& invariants,
+  const vector<double>& mNew, const vector<int>& helBef,
+  const vector<int>& helNew) {
 
   // Check if helicity vectors empty.
   double ant = AntGGemitIF::antFun(invariants, mNew, helBef, helNew);
-  if (helBef.size() < 2) {helBef.push_back(9); helBef.push_back(9);}
-  if (helNew.size() < 3) {
-    helNew.push_back(9); helNew.push_back(9); helNew.push_back(9);}
+  const vector<int>& hBef = padHel(helBef, hBefPad, 2);
+  const vector<int>& hNew = padHel(helNew, hNewPad, 3);
 
   // Save invariants.
   double sAK = invariants[0];
@@ -3512,17 +3540,17 @@ double AntGGemitIFsec::antFun(vector<double> invariants,
   double yak = sak/(sAK + sjk);
 
   // Check if j has same helicity as parent final-state gluon.
-  int hG = helBef[1];
-  int hjNow = helNew[1];
+  int hG = hBef[1];
+  int hjNow = hNew[1];
   if ( hG == hjNow ) {
     // Define j<->k symmetrisation term with sector damp parameter.
     sak += sectorDampSav * sjk;
-    vector<double> invariantsSym = {sAK, sak, sjk};
+    invSym = {sAK, sak, sjk};
     // Save swapped helicities.
-    vector<int> helSym = helNew;
-    helSym[1] = helNew[2];
-    helSym[2] = helNew[1];
-    ant += AntGGemitIF::antFun(invariantsSym, mNew, helBef, helSym);
+    hSym = hNew;
+    hSym[1] = hNew[2];
+    hSym[2] = hNew[1];
+    ant += AntGGemitIF::antFun(invSym, mNew, hBef, hSym);
 
     // Ensure positivity over all of phase space.
     ant += 1./sAK * (yak + yjk);
@@ -3541,8 +3569,9 @@ double AntGGemitIFsec::antFun(vector<double> invariants,
 
 // The antenna function, just 2*global [GeV^-2].
 
-double AntXGsplitIFsec::antFun(vector<double> invariants, vector<double> mNew,
-  vector<int> helBef, vector<int> helNew) {
+double AntXGsplitIFsec::antFun(const vector<double>& invariants,
+  const vector<double>& mNew, const vector<int>& helBef,
+  const vector<int>& helNew) {
   return 2*AntXGsplitIF::antFun(invariants,mNew,helBef,helNew);}
 
 //==========================================================================
@@ -3743,6 +3772,14 @@ vector<enum AntFunType> AntennaSetISR::getAntFunTypes () {
 
 //--------------------------------------------------------------------------
 
+// Constants: could be changed here if desired, but normally should not.
+// These are of technical nature, as described for each.
+
+// Maximum number of matrix elements cached in one event.
+const unsigned int MECs::NME2CACHEMAX = 10000;
+
+//--------------------------------------------------------------------------
+
 // Initialize pointers.
 
 void MECs::initPtr(Info* infoPtrIn, ShowerMEs* mg5mesPtrIn,
@@ -3836,6 +3873,9 @@ bool MECs::prepare(const int iSys, Event& event) {
   // If we switched off MECs completely, return here.
   if (modeMECs < 0) return false;
 
+  // A new event starts with the hard system, so clear the cache.
+  if (iSys == 0) clearME2Cache();
+
   // Initialise for no MECs, then check if MECs should be applied.
   int nAll    = partonSystemsPtr->sizeAll(iSys);
   int nOut    = partonSystemsPtr->sizeOut(iSys);
@@ -4083,13 +4123,83 @@ bool MECs::meAvailable(const vector<Particle>& state) {
 // Get squared matrix element.
 
 double MECs::getME2(const vector<Particle>& state, int nIn) {
-  return mg5mesPtr->me2Vincia(state, nIn);}
+
+  // Use the cached value if this state was already evaluated.
+  makeME2Key(state, nIn, me2Key);
+  auto it = me2Cache.find(me2Key);
+  if (it != me2Cache.end()) return it->second;
+
+  // Otherwise evaluate and store it.
+  double me2 = mg5mesPtr->me2Vincia(state, nIn);
+  if (me2Cache.size() >= NME2CACHEMAX) me2Cache.clear();
+  me2Cache[me2Key] = me2;
+  return me2;
+
+}
 
 double MECs::getME2(const int iSys, const Event& event) {
   vector<Particle> state = vinComPtr->makeParticleList(iSys, event);
   bool isResDec = partonSystemsPtr->hasInRes(iSys);
-  return (isResDec) ?
-    mg5mesPtr->me2Vincia(state, 1 ) : mg5mesPtr->me2Vincia(state, 2);
+  return (isResDec) ? getME2(state, 1) : getME2(state, 2);
+}
+
+//--------------------------------------------------------------------------
+
+// Get squared matrix elements for several states. The states that are
+// not cached are handed to the matrix-element plugin in one batch.
+
+void MECs::getME2(const vector< vector<Particle> >& states, int nIn,
+  vector<double>& me2s) {
+
+  // Collect the states that are not cached.
+  me2s.assign(states.size(), 0.);
+  vector< vector<Particle> > statesMiss;
+  iME2Miss.clear();
+  for (int i = 0; i < (int)states.size(); ++i) {
+    makeME2Key(states[i], nIn, me2Key);
+    auto it = me2Cache.find(me2Key);
+    if (it != me2Cache.end()) me2s[i] = it->second;
+    else {
+      iME2Miss.push_back(i);
+      statesMiss.push_back(states[i]);
+    }
+  }
+  if (iME2Miss.empty()) return;
+
+  // Evaluate them together and store the results.
+  vector<double> me2Miss;
+  mg5mesPtr->me2VinciaBatch(statesMiss, nIn, me2Miss);
+  if (me2Cache.size() + iME2Miss.size() > NME2CACHEMAX) me2Cache.clear();
+  for (int j = 0; j < (int)iME2Miss.size(); ++j) {
+    int i = iME2Miss[j];
+    me2s[i] = me2Miss[j];
+    makeME2Key(states[i], nIn, me2Key);
+    me2Cache[me2Key] = me2s[i];
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
+// Make the key of a state in the matrix-element cache. The colour
+// depth is included, since it is changed for the colour weights.
+
+void MECs::makeME2Key(const vector<Particle>& state, int nIn,
+  vector<double>& key) {
+  key.clear();
+  key.reserve(2 + 8 * state.size());
+  key.push_back(nIn);
+  key.push_back(mg5mesPtr->getColourDepthVincia());
+  for (const Particle& p : state) {
+    key.push_back(p.id());
+    key.push_back(p.pol());
+    key.push_back(p.col());
+    key.push_back(p.acol());
+    key.push_back(p.px());
+    key.push_back(p.py());
+    key.push_back(p.pz());
+    key.push_back(p.e());
+  }
 }
 
 //--------------------------------------------------------------------------
@@ -4186,8 +4296,13 @@ double MECs::getMECSector(int iSys, const vector<Particle>& stateNow,
   bool isResDec = partonSystemsPtr->hasInRes(iSys);
   int nIn = isResDec ? 1 : 2;
 
-  // Get matrix element for post-branching state.
-  me2post[iSys] = getME2(statePost, nIn);
+  // Get matrix element for post-branching state, and for the current
+  // state if it has changed since last matching, in one batch.
+  me2States.clear();
+  me2States.push_back(statePost);
+  if (!hasME2now[iSys]) me2States.push_back(stateNow);
+  getME2(me2States, nIn, me2Vals);
+  me2post[iSys] = me2Vals[0];
   // Sanity check.
   if (me2post[iSys] <= 0.) {
     if (verbose >= NORMAL)
@@ -4207,7 +4322,7 @@ double MECs::getMECSector(int iSys, const vector<Particle>& stateNow,
   // Get matrix element for current state
   // (only if state has changed since last matching).
   if (!hasME2now[iSys]) {
-    me2now[iSys] = getME2(stateNow, nIn);
+    me2now[iSys] = me2Vals[1];
     // Sanity check.
     if (me2now[iSys] <= 0.) {
       if (verbose >= NORMAL)
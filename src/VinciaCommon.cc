@@ -3363,9 +3363,9 @@ bool VinciaCommon::map2to3FFmassless(vector<Vec4>& pThree,
 
 // Implementations of RF clustering maps for massive partons.
 
-bool VinciaCommon::map2to3RF(vector<Vec4>& pThree, vector<Vec4> pTwo,
-  vector<double> invariants,double phi,
-  vector<double> masses) {
+bool VinciaCommon::map2to3RF(vector<Vec4>& pThree,
+  const vector<Vec4>& pTwo, const vector<double>& invariants, double phi,
+  const vector<double>& masses) {
 
   if (verbose >= DEBUG) printOut(__METHOD_NAME__, "begin", dashLen);
 
@@ -3530,9 +3530,10 @@ bool VinciaCommon::map1to2RF(vector<Vec4>& pNew, Vec4 pRes, double m1,
 //           [2]   = pk
 //           [i>3] = recoilers
 
-bool VinciaCommon::map2toNRF(vector<Vec4>& pAfter, vector<Vec4> pBefore,
-  unsigned int posR, unsigned int posF, vector<double> invariants,double phi,
-  vector<double> masses) {
+bool VinciaCommon::map2toNRF(vector<Vec4>& pAfter,
+  const vector<Vec4>& pBefore, unsigned int posR, unsigned int posF,
+  const vector<double>& invariants, double phi,
+  const vector<double>& masses) {
 
   if (verbose >= DEBUG) printOut(__METHOD_NAME__, "begin", dashLen);
 
@@ -4539,9 +4540,20 @@ bool VinciaCommon::mapToMassless(int iSys, Event& event, bool makeNewCopies) {
 
 vector<Particle> VinciaCommon::makeParticleList(const int iSys,
   const Event& event, const vector<Particle> &pNew, const vector<int> &iOld) {
+  vector<Particle> state;
+  makeParticleList(state, iSys, event, pNew, iOld);
+  return state;
+}
+
+//--------------------------------------------------------------------------
+
+// Make list of particles as vector<Particle>, filling a given list.
+
+void VinciaCommon::makeParticleList(vector<Particle>& state, const int iSys,
+  const Event& event, const vector<Particle> &pNew, const vector<int> &iOld) {
 
   // Put incoming ones (initial-state partons or decaying resonance) first.
-  vector<Particle> state;
+  state.clear();
   // reserve size for state
   state.reserve(3 + pNew.size() + partonSystemsPtr->sizeOut(iSys));
   if (partonSystemsPtr->hasInAB(iSys)) {
@@ -4597,9 +4609,6 @@ vector<Particle> VinciaCommon::makeParticleList(const int iSys,
   for (int j=0; j<(int)pNew.size(); ++j)
     if (pNew[j].isFinal()) state.push_back(pNew[j]);
 
-  // Return the state.
-  return state;
-
 }
 
 //--------------------------------------------------------------------------
@@ -357,9 +357,9 @@ void BrancherEmitFF::setMaps(int sizeOld) {
 
 // Generic getter method. Assumes setter methods called earlier.
 
-bool BrancherEmitFF::getNewParticles(Event& event, vector<Vec4> momIn,
-  vector<int> hIn, vector<Particle> &pNew, Rndm* rndmPtr, VinciaColour*
-  colourPtr) {
+bool BrancherEmitFF::getNewParticles(Event& event,
+  const vector<Vec4>& momIn, const vector<int>& hIn, vector<Particle> &pNew,
+  Rndm* rndmPtr, VinciaColour* colourPtr) {
 
   // Initialize.
   unsigned int nPost = iSav.size() + 1;
@@ -655,8 +655,9 @@ void BrancherSplitFF::setMaps(int sizeOld) {
 
 // Generic getter method. Assumes setter methods called earlier.
 
-bool BrancherSplitFF::getNewParticles(Event& event, vector<Vec4> momIn,
-  vector<int> hIn, vector<Particle> &pNew, Rndm*, VinciaColour*) {
+bool BrancherSplitFF::getNewParticles(Event& event,
+  const vector<Vec4>& momIn, const vector<int>& hIn, vector<Particle> &pNew,
+  Rndm*, VinciaColour*) {
 
   // Initialize.
   unsigned int nPost = iSav.size() + 1;
@@ -947,8 +948,9 @@ void BrancherEmitRF::setStatPost() {
 
 // Generic method, assumes setter methods called earlier.
 
-bool BrancherEmitRF::getNewParticles(Event& event, vector<Vec4> momIn,
-  vector<int> hIn, vector<Particle> &pNew, Rndm* rndmPtr, VinciaColour*) {
+bool BrancherEmitRF::getNewParticles(Event& event,
+  const vector<Vec4>& momIn, const vector<int>& hIn, vector<Particle> &pNew,
+  Rndm* rndmPtr, VinciaColour*) {
 
   // Initialize.
   unsigned int nPost = iSav.size() + 1;
@@ -1190,8 +1192,9 @@ void BrancherSplitRF::setStatPost() {
 
 // Generic method, assumes setter methods called earlier.
 
-bool BrancherSplitRF::getNewParticles(Event& event, vector<Vec4> momIn,
-  vector<int> hIn, vector<Particle>& pNew, Rndm*, VinciaColour*) {
+bool BrancherSplitRF::getNewParticles(Event& event,
+  const vector<Vec4>& momIn, const vector<int>& hIn, vector<Particle>& pNew,
+  Rndm*, VinciaColour*) {
 
   // Initialize.
   unsigned int nPost = iSav.size() + 1;
@@ -4487,13 +4490,13 @@ double VinciaFSR::getAntFunPhys(AntennaFunction* &antFunPtr) {
   // Compute physical antenna function (summed over final state
   // helicities). Note, physical antenna function can have swapped
   // labels (eg GQ -> GGQ).
-  vector<double> mPost = winnerQCD->getmPostVec();
-  vector<double> invariants = winnerQCD->getInvariants();
+  const vector<double>& mPost = winnerQCD->getmPostVec();
+  const vector<double>& invariants = winnerQCD->getInvariants();
   unsigned int nPre = winnerQCD->iVec().size();
-  vector<int> hPre = ( helicityShower && polarisedSys[iSysWin] ) ?
-    winnerQCD->hVec() : vector<int>(nPre, 9);
-  vector<int> hPost(nPre+1,9);
-  double antPhys = antFunPtr->antFun(invariants, mPost, hPre, hPost);
+  if (helicityShower && polarisedSys[iSysWin]) hPreWork = winnerQCD->hVec();
+  else hPreWork.assign(nPre, 9);
+  hPostWork.assign(nPre + 1, 9);
+  double antPhys = antFunPtr->antFun(invariants, mPost, hPreWork, hPostWork);
   if (antPhys < 0.) {
     if (verbose >= REPORT) infoPtr->errorMsg("Error in "+__METHOD_NAME__
       +": Negative Antenna Function.", num2str(antFunTypeWin));
@@ -4522,18 +4525,19 @@ double VinciaFSR::pAcceptCalc(double antPhys) {
 
 // Generate the full kinematics.
 
-bool VinciaFSR::genFullKinematics(int kineMap, Event event,
+bool VinciaFSR::genFullKinematics(int kineMap, const Event& event,
   vector<Vec4> &pPost) {
 
   // Generate branching kinematics, starting from antenna parents.
-  vector<Vec4> pPre;
-  vector<int> iPre          = winnerQCD->iVec();
-  int nPre                  = iPre.size();
-  int nPost                 = winnerQCD->iVec().size() + 1;
-  vector<double> invariants = winnerQCD->getInvariants();
-  vector<double> mPost      = winnerQCD->getmPostVec();
-  bool isRF                 = winnerQCD->posR() >= 0;
-  double phi                = 2 * M_PI * rndmPtr->flat();
+  vector<Vec4>& pPre               = pPreWork;
+  const vector<int>& iPre          = winnerQCD->iVec();
+  int nPre                         = iPre.size();
+  int nPost                        = nPre + 1;
+  const vector<double>& invariants = winnerQCD->getInvariants();
+  const vector<double>& mPost      = winnerQCD->getmPostVec();
+  bool isRF                        = winnerQCD->posR() >= 0;
+  double phi                       = 2 * M_PI * rndmPtr->flat();
+  pPre.clear();
   for (int i = 0; i < nPre; ++i) pPre.push_back(event[iPre[i]].p());
 
   // Special case for resonance decay.
@@ -4595,14 +4599,17 @@ bool VinciaFSR::acceptTrial(Event& event) {
   }
 
   // For sector shower veto branching here if outside of sector.
-  vector<Particle> stateNew;
+  vector<Particle>& stateNew = stateNewWork;
+  stateNew.clear();
   VinciaClustering minClus;
   if (sectorShower) {
     // If we have a resonance, its momentum is not stored in pNew, so we
     // create a new vector with all post-branching particles, including the
     // resonance, although being unchanged.
-    vector<Particle> ptclsPost;
-    vector<int> iOld;
+    vector<Particle>& ptclsPost = ptclsPostWork;
+    vector<int>& iOld = iOldWork;
+    ptclsPost.clear();
+    iOld.clear();
     // Check if we have a resonance.
     int iPosRes = winnerQCD->posR();
     if (iPosRes != -1) {
@@ -4615,7 +4622,7 @@ bool VinciaFSR::acceptTrial(Event& event) {
     for (auto& p : pNew) ptclsPost.push_back(p);
 
     // Get tentative post-branching state.
-    stateNew = vinComPtr->makeParticleList(iSysWin, event, ptclsPost, iOld);
+    vinComPtr->makeParticleList(stateNew, iSysWin, event, ptclsPost, iOld);
 
     // Save clustering and compute sector resolution for it.
     VinciaClustering thisClus;
@@ -4752,7 +4759,8 @@ bool VinciaFSR::getNewParticles(Event& event, AntennaFunction* antFunPtr,
     return false;
   }
   newParts.clear();
-  vector<Vec4> pPost;
+  vector<Vec4>& pPost = pPostWork;
+  pPost.clear();
   int maptype = antFunPtr->kineMap();
   if (!genFullKinematics(maptype, event, pPost)) {
     if (verbose >= DEBUG)
@@ -4763,7 +4771,8 @@ bool VinciaFSR::getNewParticles(Event& event, AntennaFunction* antFunPtr,
   }
 
   // Generate new helicities.
-  vector<int> hPost = genHelicities(antFunPtr);
+  vector<int>& hPost = hPostWork;
+  genHelicities(antFunPtr, hPost);
   if (pPost.size() != hPost.size()) {
     if (verbose >= NORMAL) {
       stringstream ss;
@@ -4786,15 +4795,16 @@ bool VinciaFSR::getNewParticles(Event& event, AntennaFunction* antFunPtr,
 
 // Generate new helicities for the antenna.
 
-vector<int> VinciaFSR::genHelicities(AntennaFunction* antFunPtr) {
+void VinciaFSR::genHelicities(AntennaFunction* antFunPtr,
+  vector<int>& hPost) {
 
-  vector<int> hPre = winnerQCD->hVec();
-  vector<int> hPost = hPre;
+  const vector<int>& hPre = winnerQCD->hVec();
+  hPost = hPre;
   hPost.insert(hPost.begin() + 1, 9);
   if (hPost.size() >=3) {
     if (helicityShower && polarisedSys[iSysWin]) {
-      vector<double> mPost = winnerQCD->getmPostVec();
-      vector<double> invariants = winnerQCD->getInvariants();
+      const vector<double>& mPost = winnerQCD->getmPostVec();
+      const vector<double>& invariants = winnerQCD->getInvariants();
       double helSum = antFunPtr->antFun(invariants, mPost, hPre, hPost);
       double randHel = rndmPtr->flat() * helSum;
       double aHel = 0.0;
@@ -4822,7 +4832,6 @@ vector<int> VinciaFSR::genHelicities(AntennaFunction* antFunPtr) {
         + " " + num2str(int(hPre[1])) + "  -> " + num2str(hPost[0]) + " "
         + num2str(hPost[1]) + " " + num2str(hPost[2]));
   }
-  return hPost;
 
 }
 
@@ -4853,8 +4862,8 @@ double VinciaFSR::getMEC(int iSys, const Event& event,
 
   // Matrix element corrections for the sector shower.
   // Get current state as list of particles.
-  vector<Particle> stateNow
-    = vinComPtr->makeParticleList(iSysWin, event);
+  vector<Particle>& stateNow = stateNowWork;
+  vinComPtr->makeParticleList(stateNow, iSysWin, event);
   mec = mecsPtr->getMECSector(iSys, stateNow, statePost, thisClus);
   // Sanity check.
   if (mec < 0.) {
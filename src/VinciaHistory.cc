@@ -1545,7 +1545,7 @@ void VinciaHistory::findBestHistory() {
       foundValidHistory = true;
       failedMSCut = false;
       foundIncompleteHistory = isIncomplete;
-      historyBest = std::get<2>(hPerm);
+      historyBest = std::move(std::get<2>(hPerm));
       ME2guessBest = ME2guessNow;
       if (verbose >= DEBUG) {
         stringstream ss;
@@ -1567,6 +1567,10 @@ void VinciaHistory::findBestHistory() {
     stringstream ss;
     ss<<"Best history has weight: "<< ME2guessBest;
     printOut(__METHOD_NAME__,ss.str());
+    ss.str("");
+    ss << "Clustered " << nNodesVisited << " history nodes, reused "
+       << nNodesReused << ".";
+    printOut(__METHOD_NAME__,ss.str());
     printOut(__METHOD_NAME__,"end", dashLen);
   }
 }
@@ -2279,61 +2283,44 @@ std::tuple<bool,double,HistoryNodes> VinciaHistory::findHistoryPerm(
   if (sysToHistory.size() == 0)
     return make_tuple(isIncomplete,0.,sysToHistory);
 
-  // Now loop over systems and find histories.
+  // Give up on this colour flow right away if one of its systems already
+  // failed in another colour flow, before clustering any of the others.
   for(auto itHistory = sysToHistory.begin(); itHistory != sysToHistory.end();
       ++itHistory) {
-
-    int iSys = itHistory->first;
-    bool isResSys = (iSys == 0 ) ? false : true;
-
-    vector<HistoryNode>& history = itHistory->second;
-    bool foundIncomplete = false;
-
-    // Check if we hit the Born configuration.
-    while (!foundIncomplete && !isBorn(history.back(), isResSys)) {
-
-      // Check if we found any valid clusterings.
-      int nClusterings =
-        history.back().getNClusterings(vinMergingHooksPtr,infoPtr,verbose);
-      if (nClusterings <= 0) {
-        if (verbose >= DEBUG)
-          printOut("VinciaHistory::findHistoryPerm()",
-            "Couldn't find any clusterings.");
-        // This is an incomplete history.
-        foundIncomplete = true;
-        continue;
-      }
-
+    makeSystemKey(itHistory->second.front(), itHistory->first, systemKey);
+    auto itSaved = systemHistories.find(systemKey);
+    if (itSaved == systemHistories.end()) continue;
+    double ME2guessSys = itSaved->second.ME2guess;
+    if (!itSaved->second.success || ME2guessSys <= 0.
+      || std::isnan(ME2guessSys)) {
       if (verbose >= DEBUG)
-        printOut("VinciaHistory::findHistoryPerm()","Found "
-          + num2str(nClusterings,3) + " clusterings.");
-
-      // Perform clustering that corresponds to minimal sector resolution.
-      HistoryNode next;
-      if (!history.back().cluster(next, infoPtr, verbose)) {
-        infoPtr->errorMsg("Error in VinciaHistory::findHistoryPerm",
-          ": Could not perform clustering");
-        return make_tuple(isIncomplete,0.,HistoryNodes());
-      }
+        printOut("VinciaHistory::findHistoryPerm()", "System "
+          + num2str(itHistory->first,2) + " failed in earlier colour flow.");
+      return make_tuple(isIncomplete,0.,HistoryNodes());
+    }
+  }
 
-      // Save.
-      history.push_back(std::move(next));
+  // Now loop over systems and find histories.
+  for(auto itHistory = sysToHistory.begin(); itHistory != sysToHistory.end();
+      ++itHistory) {
 
-      // Iterate until we hit Born topology (compare to hard process).
-    }
+    int iSys = itHistory->first;
 
-    if (verbose >= DEBUG) {
-      stringstream ss;
-      if (!foundIncomplete) ss << "Reached Born topology in system " << iSys;
-      else ss << "Found incomplete history in system " << iSys;
-      printOut("VinciaHistory::findHistoryPerm()",ss.str());
+    // Cluster this system, or fetch it if it was met before.
+    const SystemHistory& sysHistory
+      = findHistorySys(itHistory->second.front(), iSys);
+    if (!sysHistory.success) {
+      infoPtr->errorMsg("Error in VinciaHistory::findHistoryPerm",
+        ": Could not perform clustering");
+      return make_tuple(isIncomplete,0.,HistoryNodes());
     }
+    itHistory->second = sysHistory.history;
 
     // Check if incomplete.
-    if (foundIncomplete) isIncomplete = true;
+    if (sysHistory.isIncomplete) isIncomplete = true;
 
     // Fetch the parton shower weight.
-    double ME2guessSys = calcME2guess(history, isResSys);
+    double ME2guessSys = sysHistory.ME2guess;
     ME2guess *= ME2guessSys;
 
     // Stop if non-positive or nan weight.
@@ -2355,6 +2342,113 @@ std::tuple<bool,double,HistoryNodes> VinciaHistory::findHistoryPerm(
 
 //--------------------------------------------------------------------------
 
+// Construct the history of a single system. The clusterings are
+// deterministic, so the outcome only depends on the first node and is
+// saved for other colour flows that contain the same system.
+
+const SystemHistory& VinciaHistory::findHistorySys(
+  const HistoryNode& firstNode, int iSys) {
+
+  // Reuse the history if this system was clustered before.
+  makeSystemKey(firstNode, iSys, systemKey);
+  auto itSaved = systemHistories.find(systemKey);
+  if (itSaved != systemHistories.end()) {
+    nNodesReused += itSaved->second.history.size();
+    return itSaved->second;
+  }
+  SystemHistory& sysHistory = systemHistories[systemKey];
+  vector<HistoryNode>& history = sysHistory.history;
+  history.push_back(firstNode);
+  ++nNodesVisited;
+  bool isResSys = (iSys == 0 ) ? false : true;
+  bool foundIncomplete = false;
+
+  // Check if we hit the Born configuration.
+  while (!foundIncomplete && !isBorn(history.back(), isResSys)) {
+
+    // Check if we found any valid clusterings.
+    int nClusterings =
+      history.back().getNClusterings(vinMergingHooksPtr,infoPtr,verbose);
+    if (nClusterings <= 0) {
+      if (verbose >= DEBUG)
+        printOut("VinciaHistory::findHistorySys()",
+          "Couldn't find any clusterings.");
+      // This is an incomplete history.
+      foundIncomplete = true;
+      continue;
+    }
+
+    if (verbose >= DEBUG)
+      printOut("VinciaHistory::findHistorySys()","Found "
+        + num2str(nClusterings,3) + " clusterings.");
+
+    // Perform clustering that corresponds to minimal sector resolution.
+    HistoryNode next;
+    if (!history.back().cluster(next, infoPtr, verbose)) return sysHistory;
+
+    // Save.
+    history.push_back(std::move(next));
+    ++nNodesVisited;
+
+    // Iterate until we hit Born topology (compare to hard process).
+  }
+
+  if (verbose >= DEBUG) {
+    stringstream ss;
+    if (!foundIncomplete) ss << "Reached Born topology in system " << iSys;
+    else ss << "Found incomplete history in system " << iSys;
+    printOut("VinciaHistory::findHistorySys()",ss.str());
+  }
+
+  // Fetch the parton shower weight.
+  sysHistory.isIncomplete = foundIncomplete;
+  sysHistory.ME2guess = calcME2guess(history, isResSys);
+  sysHistory.success = true;
+  return sysHistory;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Make the key of a system from its first node: the system number, the
+// resonance information, the clusterable chains, and the event record.
+
+void VinciaHistory::makeSystemKey(const HistoryNode& node, int iSys,
+  vector<double>& key) const {
+
+  key.clear();
+  key.push_back(iSys);
+  key.push_back(node.hasRes);
+  key.push_back(node.iRes);
+  key.push_back(node.idRes);
+  key.push_back(node.nMinQQbar);
+  key.push_back(node.getEvolNow());
+  for (const vector<int>& chain : node.clusterableChains) {
+    key.push_back(chain.size());
+    for (int i : chain) key.push_back(i);
+  }
+  key.push_back(node.state.size());
+  for (int i = 0; i < node.state.size(); ++i) {
+    const Particle& p = node.state[i];
+    key.push_back(p.id());
+    key.push_back(p.status());
+    key.push_back(p.mother1());
+    key.push_back(p.mother2());
+    key.push_back(p.daughter1());
+    key.push_back(p.daughter2());
+    key.push_back(p.col());
+    key.push_back(p.acol());
+    key.push_back(p.px());
+    key.push_back(p.py());
+    key.push_back(p.pz());
+    key.push_back(p.e());
+    key.push_back(p.m());
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
 // Check to see if history failed merging scale cut.
 
 bool VinciaHistory::checkMergingCut(HistoryNodes& history) {
@@ -2375,7 +2469,7 @@ bool VinciaHistory::checkMergingCut(HistoryNodes& history) {
     // Loop over systems and check last node.
     for(auto itSys = history.begin(); itSys != history.end(); ++itSys) {
       // Loop over the history of this system.
-      vector<HistoryNode> historyNow = itSys->second;
+      const vector<HistoryNode>& historyNow = itSys->second;
       for (auto itHistory = historyNow.begin(); itHistory != historyNow.end();
            ++itHistory) {
         // Failed.
@@ -3168,8 +3168,10 @@ bool VinciaISR::branch(Event& event) {
   }
 
   // Recoiler, allow for both II and IF to have global recoils
-  vector<Vec4> recoilers;
-  vector<int> iRecs;
+  vector<Vec4>& recoilers = recoilersWork;
+  vector<int>& iRecs      = iRecsWork;
+  recoilers.clear();
+  iRecs.clear();
   for (int j = 0; j < partonSystemsPtr->sizeOut(iSysWin); ++j) {
     int ip = partonSystemsPtr->getOut(iSysWin, j);
     if (ip != winnerPtr->i1sav && ip != winnerPtr->i2sav) {
@@ -3236,9 +3238,15 @@ bool VinciaISR::branch(Event& event) {
     // indices of particles to replace in current state. In local
     // kinematic maps both are only mothers, in global maps
     // also all recoilers.
-    vector<Particle> ptclsPost = {winnerPtr->new1,winnerPtr->new2,
-                                  winnerPtr->new3};
-    vector<int> iOld = {winnerPtr->i1sav, winnerPtr->i2sav};
+    vector<Particle>& ptclsPost = ptclsPostWork;
+    vector<int>& iOld = iOldWork;
+    ptclsPost.clear();
+    ptclsPost.push_back(winnerPtr->new1);
+    ptclsPost.push_back(winnerPtr->new2);
+    ptclsPost.push_back(winnerPtr->new3);
+    iOld.clear();
+    iOld.push_back(winnerPtr->i1sav);
+    iOld.push_back(winnerPtr->i2sav);
     for (int i(0); i<(int)iRecs.size(); ++i) {
       // Append index of recoiling particle to list of old particles.
       iOld.push_back(iRecs.at(i));
@@ -3249,7 +3257,7 @@ bool VinciaISR::branch(Event& event) {
     }
 
     // Get tentative post-branching state.
-    stateNew = vinComPtr->makeParticleList(iSysWin, event, ptclsPost, iOld);
+    vinComPtr->makeParticleList(stateNew, iSysWin, event, ptclsPost, iOld);
 
     // Save clustering and compute sector resolution for it.
     enum AntFunType antFunTypeWin = winnerPtr->antFunTypePhys(indxWin);
@@ -3303,9 +3311,9 @@ bool VinciaISR::branch(Event& event) {
   }
 
   // Check whether phase-space is closed for getting rid of heavy quarks.
-  vector<Particle> parts = vinComPtr->makeParticleList(iSysWin, event);
-  if (!forceSplitting)
-    if (!checkHeavyQuarkPhaseSpace(parts,iSysWin)) {
+  if (!forceSplitting) {
+    vinComPtr->makeParticleList(partsWork, iSysWin, event);
+    if (!checkHeavyQuarkPhaseSpace(partsWork, iSysWin)) {
       if (verbose >= DEBUG) printOut(__METHOD_NAME__,
           "branching rejected because phase space after branching "
           "does not allow forced splittings");
@@ -3315,6 +3323,7 @@ bool VinciaISR::branch(Event& event) {
         diagnosticsPtr->stop(__METHOD_NAME__,"trialVeto(HQPS)");
       return false;
     }
+  }
 
   // Check if this branching is above cutoff scale (but don't say no
   // to getting rid of a massive flavour).
@@ -3357,7 +3366,7 @@ bool VinciaISR::branch(Event& event) {
 
   // Put new particles into event record, store a copy of event, to be
   // used if branching vetoed by userHooks.
-  Event evtOld   = event;
+  if (canVetoEmission) evtOldWork = event;
   int sizeOld    = event.size();
   int i1sav      = winnerPtr->i1sav;
   int i2sav      = winnerPtr->i2sav;
@@ -3521,7 +3530,7 @@ bool VinciaISR::branch(Event& event) {
   // Veto by userHooks, possibility to allow user veto of emission step.
   if (canVetoEmission)
     if (userHooksPtr->doVetoISREmission(sizeOld, event, iSysWin)) {
-      event = evtOld;
+      event = evtOldWork;
       if (verbose >= DEBUG)
         printOut(__METHOD_NAME__, "Branching vetoed by user.");
       if (verbose >= REPORT)
@@ -4434,7 +4443,10 @@ bool VinciaISR::generateKinematicsII(Event& event,
   // Generate random (uniform) phi angle.
   double phi = 2 * M_PI * rndmPtr->flat();
   // Generate branching kinematics, starting from dipole-antenna parents.
-  vector<Vec4> pOld, pNew;
+  vector<Vec4>& pOld = pOldWork;
+  vector<Vec4>& pNew = pNewWork;
+  pOld.clear();
+  pNew.clear();
   pOld.push_back(event[trialPtr->i1sav].p());
   pOld.push_back(event[trialPtr->i2sav].p());
   if (!forceSplitting &&
@@ -4668,7 +4680,10 @@ bool VinciaISR::generateKinematicsIF(Event& event,
   double sak = sAK + sjk - saj + m2j + m2k -m2Kold;
 
   // Generate branching kinematics, starting from dipole-antenna parents.
-  vector<Vec4> pOld, pNew;
+  vector<Vec4>& pOld = pOldWork;
+  vector<Vec4>& pNew = pNewWork;
+  pOld.clear();
+  pNew.clear();
   pOld.push_back(event[trialPtr->i1sav].p());
   pOld.push_back(event[trialPtr->i2sav].p());
   // Decide whether to use local map 100% of the time or allow probabilistic
@@ -4944,14 +4959,27 @@ bool VinciaISR::acceptTrial(const Event& event, BranchElementalISR* trialPtr) {
     m2ant  = trialPtr->new1.m();
   }
   // Fill vectors to use for antenna-function evaluation.
-  vector<double> invariants {S12, s1jant, sj2ant, trialPtr->s13()};
+  vector<double>& invariants = invariantsWork;
+  invariants.resize(4);
+  invariants[0] = S12;
+  invariants[1] = s1jant;
+  invariants[2] = sj2ant;
+  invariants[3] = trialPtr->s13();
   // So far ISR is massless.
-  vector<double> mNew {m1ant, mjant, m2ant};
+  vector<double>& mNew = mNewWork;
+  mNew.resize(3);
+  mNew[0] = m1ant;
+  mNew[1] = mjant;
+  mNew[2] = m2ant;
   // Parent helicities.
   // TODO: check! we insert doubles to vector<int>
-  vector<int> helBef {static_cast<int>(hAant), static_cast<int>(hBant)};
+  vector<int>& helBef = hBefWork;
+  helBef.resize(2);
+  helBef[0] = static_cast<int>(hAant);
+  helBef[1] = static_cast<int>(hBant);
   // Total accept is summed over daughter helicities (selection done below).
-  vector<int> helUnpol {9, 9, 9};
+  vector<int>& helUnpol = hUnpolWork;
+  helUnpol.assign(3, 9);
 
   // Compute spin-summed physical antennae (spin selection below).
   // Define pointer antennae.
@@ -5067,7 +5095,11 @@ bool VinciaISR::acceptTrial(const Event& event, BranchElementalISR* trialPtr) {
     for (hi = hAant; abs(hi) <= 1; hi -= 2*hAant) {
       for (hk = hBant; abs(hk) <= 1; hk -= 2*hBant) {
         for (hj = hAant; abs(hj) <= 1; hj -= 2*hAant) {
-          vector<int> helNow {hi, hj, hk};
+          vector<int>& helNow = hNowWork;
+          helNow.resize(3);
+          helNow[0] = hi;
+          helNow[1] = hj;
+          helNow[2] = hk;
           aHel = antFunPtr->antFun(invariants, mNew, helBef, helNow);
           randHel -= aHel;
           if (verbose >= DEBUG) {
@@ -5424,7 +5456,8 @@ bool VinciaISR::assignColourFlow(Event& event, BranchElementalISR* trialPtr) {
 // Method to check if a gluon splitting in the initial state (to get
 // rid of heavy quarks) is still possible after the current branching.
 
-bool VinciaISR::checkHeavyQuarkPhaseSpace(vector<Particle> parts, int) {
+bool VinciaISR::checkHeavyQuarkPhaseSpace(const vector<Particle>& parts,
+  int) {
 
   vector<int> isToCheck; isToCheck.resize(0);
   for (int i = 0; i < (int)parts.size(); i++)
@@ -5433,7 +5466,7 @@ bool VinciaISR::checkHeavyQuarkPhaseSpace(vector<Particle> parts, int) {
 
   // Loop over partons to check.
   for (int i = 0; i < (int)isToCheck.size(); i++) {
-    Particle heavyQuark = parts[isToCheck[i]];
+    const Particle& heavyQuark = parts[isToCheck[i]];
     int hQcol           = ( (heavyQuark.col() == 0) ?
       heavyQuark.acol() : heavyQuark.col() );
     double mass         = ((heavyQuark.idAbs() == 4) ? mc : mb);
@@ -5443,7 +5476,7 @@ bool VinciaISR::checkHeavyQuarkPhaseSpace(vector<Particle> parts, int) {
       if (j != isToCheck[i]) {
         if ( (parts[j].col() != hQcol) && (parts[j].acol() != hQcol) )
           continue;
-        Particle colPartner = parts[i];
+        const Particle& colPartner = parts[i];
         double sHqCp        = m2(heavyQuark, colPartner);
         double Q2max        = 0.0;
         if (colPartner.isFinal())
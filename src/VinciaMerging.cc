@@ -68,6 +68,8 @@ void VinciaMerging::init() {
   nBelowMS=0;
   nTotal=0;
   nAbort=0;
+  nNodesVisited=0;
+  nNodesReused=0;
   nVetoByMult=vector<int>(nMaxJets+1,0);
   nTotalByMult=vector<int>(nMaxJets+1,0);
 
@@ -148,6 +150,13 @@ void VinciaMerging::statistics() {
       }
       cout << " |                                                       "
            << "                                                          | \n";
+      string nNodesStr = std::to_string(nNodesVisited) + " clustered, "
+        + std::to_string(nNodesReused) + " reused";
+      cout << " | History nodes: " << nNodesStr;
+      for (int ws(0); ws<97-int(nNodesStr.size()); ++ws) cout << " ";
+      cout << "|" << endl;
+      cout << " |                                                       "
+           << "                                                          | \n";
     }
     cout << " *---------------------------------------------------------------"
          <<"--------------------------------------------------*";
@@ -238,6 +247,8 @@ int VinciaMerging::mergeProcessSector(Event& process) {
   VinciaHistory history(newProcess, beamAPtr, beamBPtr,
     mergingHooksPtr, trialPartonLevelPtr, particleDataPtr, infoPtr);
   auto stop = std::clock();
+  nNodesVisited += history.getNNodesVisited();
+  nNodesReused  += history.getNNodesReused();
 
   //TODO implement accept for unordered histories for MOPS-like merging.
 